@@ -45,9 +45,15 @@ SUPPORTED_CLOCK_DOMAINS = {
     "hpc"      : SUPPORTED_CLOCK_DOMAINS_HPC
 }
 # These slaves reside statically in the MAIN_CLOCK_DOMAIN
-MAIN_CLOCK_DOMAIN_SLAVES = ["BRAM", "DM_mem", "PLIC"]
+MAIN_CLOCK_DOMAIN_SLAVES = ["BRAM", "DM_mem", "PLIC", "CACHE_CTRL"]
 # The DDR clock must have the same frequency of the DDR board clock
 DDR_FREQUENCY = 300
+# DDR system cache geometry (PG118), the line length is in 32-bit words and a line
+# must hold at least a beat of the 512-bit DDR interface
+SUPPORTED_CACHE_NUM_WAYS = [2, 4, 8, 16]
+SUPPORTED_CACHE_LINE_LENGTHS = [16, 32]
+MIN_CACHE_SIZE = 32768
+MAX_CACHE_SIZE = 8388608
 
 #############################
 # Check intra configuration #
@@ -172,6 +178,18 @@ def check_intra_config(config : configuration.Configuration, config_file_name: s
                     print_error(f"The DDR and HBUS frequency {config.RANGE_CLOCK_DOMAINS[i]} must be the same of DDR board clock {DDR_FREQUENCY}")
                     return False
 
+    # Check the DDR system cache geometry
+    if config.CONFIG_NAME == "MBUS":
+        if config.CACHE_NUM_WAYS not in SUPPORTED_CACHE_NUM_WAYS:
+            print_error(f"CACHE_NUM_WAYS={config.CACHE_NUM_WAYS} is not supported, valid values are {SUPPORTED_CACHE_NUM_WAYS}")
+            return False
+        if config.CACHE_LINE_LENGTH not in SUPPORTED_CACHE_LINE_LENGTHS:
+            print_error(f"CACHE_LINE_LENGTH={config.CACHE_LINE_LENGTH} words is not supported, valid values are {SUPPORTED_CACHE_LINE_LENGTHS}")
+            return False
+        if (config.CACHE_SIZE & (config.CACHE_SIZE - 1)) != 0 or not (MIN_CACHE_SIZE <= config.CACHE_SIZE <= MAX_CACHE_SIZE):
+            print_error(f"CACHE_SIZE={config.CACHE_SIZE} must be a power of two in ({MIN_CACHE_SIZE}..{MAX_CACHE_SIZE})")
+            return False
+
     # Check the presence of multiple BRAMs, for now a single occurrence of BRAM is supported
     # Assume BRAM as prefix for any BRAM declaration
     bram_name = "BRAM"
@@ -1,7 +1,7 @@
 #!/bin/bash
 # Author: Stefano Mercogliano <stefano.mercogliano@unina.it>
 # Description:
-#   Replace config-based content of output file (sw/SoC/common/config.mk) based on XLEN values (system_config.csv)
+#   Replace config-based content of output file (sw/SoC/common/config.mk) based on XLEN and CORE_SELECTOR values (system_config.csv)
 #   Target values are parsed and from inputs and updated in output file.
 #   Currently we only support 32 and 64 unknown toolchain.
 #   In the future, we might support a more flexible toolchain selection flow (e.g. rv64-linux) and flags
@@ -45,4 +45,16 @@ else
     exit 1;
 fi
 
+core_value=$(grep "CORE_SELECTOR" ${CONFIG_SYS_CSV} | awk -F "," '{print $2}');
+
+if [[ "$core_value" == CORE_* ]]; then
+
+    echo "[CONFIG_SW] Setting CORE_SELECTOR to ${core_value} "
+    sed -E -i "s/CORE_SELECTOR.?\?=.+/CORE_SELECTOR \?= ${core_value}/g" ${OUTPUT_MK_FILE};
+
+else
+    echo "[CONFIG_SW][ERROR] Invalid CORE_SELECTOR=$core_value value";
+    exit 1;
+fi
+
 echo "[CONFIG_SW] Output file is at ${OUTPUT_MK_FILE}"
@@ -187,10 +187,44 @@ for slave in ${slaves[*]}; do
         echo "[CONFIG_XILINX] Updating CACHE_HIGHADDR = 0x$(printf '%x' $ddr_high)"
     fi
 
+    # Check if this slave is the cache control interface
+    if [[ "$slave" == "CACHE_CTRL" ]]; then
+        ctrl_base_hex=${range_base_addrs[$cnt]#0x}
+        ctrl_base=$((0x$ctrl_base_hex))
+        range_width=${range_addr_widths[$cnt]}
+        ctrl_high=$(( ctrl_base + (1 << range_width) - 1 ))
+
+        cache_config=${XILINX_IPS_ROOT}/hpc/xlnx_system_cache_0/config.tcl
+
+        # Update CACHE_CTRL_BASEADDR and CACHE_CTRL_HIGHADDR in TCL
+        sed -E -i "s#(set CACHE_CTRL_BASEADDR)[[:space:]]*\{[^}]+\}#\1 {0x$(printf '%x' $ctrl_base)}#g" "${cache_config}"
+        sed -E -i "s#(set CACHE_CTRL_HIGHADDR)[[:space:]]*\{[^}]+\}#\1 {0x$(printf '%x' $ctrl_high)}#g" "${cache_config}"
+        echo "[CONFIG_XILINX] Updating CACHE_CTRL_BASEADDR = 0x$(printf '%x' $ctrl_base), CACHE_CTRL_HIGHADDR = 0x$(printf '%x' $ctrl_high)"
+    fi
+
     # Increment counter
     ((cnt++))
 done
 
+# Cache geometry, only set in configurations with a system cache (hpc)
+# CSV property and corresponding IP parameter
+cache_geometry=(
+        CACHE_SIZE:C_CACHE_SIZE
+        CACHE_NUM_WAYS:C_NUM_WAYS
+        CACHE_LINE_LENGTH:C_CACHE_LINE_LENGTH
+    )
+cache_config=${XILINX_IPS_ROOT}/hpc/xlnx_system_cache_0/config.tcl
+for pair in ${cache_geometry[*]}; do
+    target=${pair%%:*}
+    ip_param=${pair##*:}
+    target_value=$(grep "^${target}," ${CONFIG_MAIN_CSV} | awk -F "," '{print $2}');
+    if [[ -n "$target_value" ]]; then
+        # NOTE: this will trigger the rebuild of the IP
+        sed -E -i "s/CONFIG.${ip_param} ?\{[[:digit:]]+\}/CONFIG.${ip_param} {${target_value}}/g" ${cache_config};
+        echo "[CONFIG_XILINX] Updating ${ip_param} = ${target_value}"
+    fi
+done
+
 
 #################
 # CLOCK DOMAINS #
@@ -49,6 +49,9 @@ class Configuration:
 		self.BUSER_WIDTH		 : int = 0		# AXI  B User width
 		self.MAIN_CLOCK_DOMAIN   : int = 100    # Core + mbus clock domain (the main clock domain)
 		self.RANGE_CLOCK_DOMAINS       : list = []    # MBUS slaves clock domains
+		self.CACHE_SIZE          : int = 32768  # DDR system cache size in bytes (hpc only)
+		self.CACHE_NUM_WAYS      : int = 2      # DDR system cache associativity (hpc only)
+		self.CACHE_LINE_LENGTH   : int = 32     # DDR system cache line length in 32-bit words (hpc only)
 
     ###########
     # Setters #
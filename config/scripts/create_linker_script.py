@@ -146,6 +146,14 @@ for block in device_dict['memory']:
 	fd.write("\t" + block['device'] + " (xrw) : ORIGIN = 0x" + format(block['base'], "016x") + ",  LENGTH = " + hex(block['range']) + "\n")
 fd.write("}\n")
 
+# Generate symbols from memory blocks
+# These can be used to carve buffers out of memories not used by the sections below (e.g. DDR)
+fd.write("\n")
+fd.write("/* Memory blocks symbols */\n")
+for block in device_dict['memory']:
+	fd.write("_" + block['device'] + "_start = 0x" + format(block['base'], "016x") + ";\n")
+	fd.write("_" + block['device'] + "_end = 0x" + format(block['base'] + block['range'], "016x") + ";\n")
+
 # Generate symbols from peripherals
 fd.write("\n")
 fd.write("/* Peripherals symbols */\n")
@@ -176,9 +184,22 @@ fd.write("_vector_table_end = 0x" + format(vector_table_start + 32*4, "016x") +
 stack_start = device_dict['memory'][BOOT_MEMORY_BLOCK]['base'] + device_dict['memory'][BOOT_MEMORY_BLOCK]['range'] - 0x8
 fd.write("_stack_start = 0x" + format(stack_start, "016x") + ";\n")
 
+# The cold memory block is the largest memory block other than the boot one (e.g. DDR).
+# It holds the cold sections (libuninasoc section.h), then the heap (libuninasoc heap.h).
+# Without such a block the cold sections fall back to the boot memory and the heap is empty
+cold_blocks = [block for index, block in enumerate(device_dict['memory']) if index != BOOT_MEMORY_BLOCK]
+cold_block = None
+if len(cold_blocks) > 0:
+	cold_block = max(cold_blocks, key=lambda block: block['range'])
+	# The heap starts after the cold sections, see below
+	fd.write("_heap_end = 0x" + format(cold_block['base'] + cold_block['range'], "016x") + ";\n")
+else:
+	fd.write("_heap_start = 0x" + format(stack_start, "016x") + ";\n")
+	fd.write("_heap_end = 0x" + format(stack_start, "016x") + ";\n")
+
 # Generate sections
-# vector table and text sections are here defined.
-# data, bss and rodata can be explicitly defined by the user application if required.
+# vector table, text, data, bss and rodata sections are here defined, in the boot memory.
+# The user application can place its own sections in ld/user.ld if required.
 fd.write("\n")
 fd.write("/* Sections */\n")
 fd.write("SECTIONS\n")
@@ -198,12 +219,89 @@ fd.write("\t\t. = ALIGN(32);\n")
 fd.write("\t\t_text_start = .;\n")
 fd.write("\t\t*(.text.handlers)\n")
 fd.write("\t\t*(.text.start)\n")
+fd.write("\t\t*(.hot.text)\n")
 fd.write("\t\t*(.text)\n")
 fd.write("\t\t*(.text*)\n")
+if cold_block is None:
+	fd.write("\t\t*(.cold.text)\n")
 fd.write("\t\t. = ALIGN(32);\n")
 fd.write("\t\t_text_end = .;\n")
 fd.write("\t}> " + device_dict['memory'][BOOT_MEMORY_BLOCK]['device'] + "\n")
 
+# Hot data section, in the boot memory
+fd.write("\n")
+fd.write("\t.hot_data :\n")
+fd.write("\t{\n")
+fd.write("\t\t. = ALIGN(8);\n")
+fd.write("\t\t_hot_data_start = .;\n")
+fd.write("\t\t*(.hot.rodata)\n")
+fd.write("\t\t*(.hot.data)\n")
+if cold_block is None:
+	fd.write("\t\t*(.cold.rodata)\n")
+	fd.write("\t\t*(.cold.data)\n")
+fd.write("\t\t. = ALIGN(8);\n")
+fd.write("\t\t_hot_data_end = .;\n")
+fd.write("\t}> " + device_dict['memory'][BOOT_MEMORY_BLOCK]['device'] + "\n")
+
+# Default data sections, in the boot memory. The startup code zeroes [_bss_start, _bss_end)
+# Placed explicitly: left to the orphan placement, ld would put them after the cold section,
+# in the cold memory block and over the heap
+fd.write("\n")
+fd.write("\t.rodata :\n")
+fd.write("\t{\n")
+fd.write("\t\t. = ALIGN(8);\n")
+fd.write("\t\t*(.rodata)\n")
+fd.write("\t\t*(.rodata*)\n")
+fd.write("\t\t*(.srodata)\n")
+fd.write("\t\t*(.srodata*)\n")
+fd.write("\t}> " + device_dict['memory'][BOOT_MEMORY_BLOCK]['device'] + "\n")
+
+fd.write("\n")
+fd.write("\t.data :\n")
+fd.write("\t{\n")
+fd.write("\t\t. = ALIGN(8);\n")
+fd.write("\t\t*(.data)\n")
+fd.write("\t\t*(.data*)\n")
+fd.write("\t\t*(.sdata)\n")
+fd.write("\t\t*(.sdata*)\n")
+fd.write("\t}> " + device_dict['memory'][BOOT_MEMORY_BLOCK]['device'] + "\n")
+
+fd.write("\n")
+fd.write("\t.bss :\n")
+fd.write("\t{\n")
+fd.write("\t\t. = ALIGN(8);\n")
+fd.write("\t\t_bss_start = .;\n")
+fd.write("\t\t*(.sbss)\n")
+fd.write("\t\t*(.sbss*)\n")
+fd.write("\t\t*(.bss)\n")
+fd.write("\t\t*(.bss*)\n")
+fd.write("\t\t*(COMMON)\n")
+fd.write("\t\t. = ALIGN(8);\n")
+fd.write("\t\t_bss_end = .;\n")
+fd.write("\t}> " + device_dict['memory'][BOOT_MEMORY_BLOCK]['device'] + "\n")
+
+# Cold section, code and data at the beginning of the cold memory block, followed by the heap
+if cold_block is not None:
+	fd.write("\n")
+	fd.write("\t.cold :\n")
+	fd.write("\t{\n")
+	fd.write("\t\t_cold_start = .;\n")
+	fd.write("\t\t*(.cold.text)\n")
+	fd.write("\t\t*(.cold.rodata)\n")
+	fd.write("\t\t*(.cold.data)\n")
+	fd.write("\t\t. = ALIGN(16);\n")
+	fd.write("\t\t_cold_end = .;\n")
+	fd.write("\t}> " + cold_block['device'] + "\n")
+	fd.write("\t_heap_start = _cold_end;\n")
+
+# Trace format strings (libuninasoc trace.h)
+# Kept in the ELF for the host decoder but never loaded: the string offsets are the format IDs
+fd.write("\n")
+fd.write("\t.trace_fmt 0 (INFO) :\n")
+fd.write("\t{\n")
+fd.write("\t\tKEEP(*(.trace_fmt))\n")
+fd.write("\t}\n")
+
 fd.write("}\n")
 
 # Files closing
@@ -1,18 +1,23 @@
 #!/bin/python3.10
 # Author: Salvatore Santoro <sal.santoro@studenti.unina.it>
 # Author: Vincenzo Maisto <vincenzo.maisto2@unina.it>
-# Description: Parse PBUS config and generate HAL header
+# Description: Parse MBUS and PBUS configs and generate HAL header
 
 import sys
 import os
 
 # Check for correct number of arguments
-if len(sys.argv) != 3:
-    print("Usage: '<CONFIG_PERIPHERALS_CSV>' <OUTPUT_HAL_CONF_FILE>")
+if len(sys.argv) != 4:
+    print("Usage: '<CONFIG_MAIN_BUS_CSV>' '<CONFIG_PERIPHERALS_CSV>' <OUTPUT_HAL_CONF_FILE>")
     sys.exit(1)
 
-peripheral_csv_path = sys.argv[1]
-output_hal_conf_file = sys.argv[2]
+mainbus_csv_path = sys.argv[1]
+peripheral_csv_path = sys.argv[2]
+output_hal_conf_file = sys.argv[3]
+
+if mainbus_csv_path is None:
+    print("[ERROR]: config_main_bus.csv not found")
+    sys.exit(1)
 
 if peripheral_csv_path is None:
     print("[ERROR]: config_peripheral_bus.csv not found")
@@ -21,6 +26,35 @@ if peripheral_csv_path is None:
 # List of device peripherals
 devices = list()
 
+# Clock frequencies (MHz) of the main bus and of its slaves
+main_clock_domain = None
+mainbus_names = list()
+mainbus_clock_domains = list()
+
+# DDR system cache geometry (hpc only), from the properties of the main bus
+cache_geometry = dict()
+
+# Main bus slaves (e.g. PLIC, DDR channels, HLS_CONTROL)
+with open(mainbus_csv_path, 'r') as file:
+    # For each line
+    for line in file:
+        # Parse RANGE_NAMES
+        if line.startswith('RANGE_NAMES'):
+            names_str = line.strip().split(',', 1)[1]
+            mainbus_names = names_str.split()
+            # Skip buses (the last three chars are BUS), as in the linker script generation
+            devices += [name for name in mainbus_names if name[-3:] != "BUS"]
+        # Parse MAIN_CLOCK_DOMAIN
+        elif line.startswith('MAIN_CLOCK_DOMAIN'):
+            main_clock_domain = line.strip().split(',', 1)[1]
+        # Parse RANGE_CLOCK_DOMAINS
+        elif line.startswith('RANGE_CLOCK_DOMAINS'):
+            mainbus_clock_domains = line.strip().split(',', 1)[1].split()
+        # Parse CACHE_SIZE, CACHE_NUM_WAYS and CACHE_LINE_LENGTH
+        elif line.startswith('CACHE_'):
+            key, value = line.strip().split(',', 1)
+            cache_geometry[key] = int(value)
+
 # Open the file whose path is stored in peripheral_csv_path
 with open(peripheral_csv_path, 'r') as file:
     # For each line
@@ -58,6 +92,23 @@ for device in devices:
     macro_name = f"{device.upper()}_IS_ENABLED"
     lines.append(f"#define {macro_name} 1")
 
+# Clock frequencies, e.g. the peripherals (timers) run at PBUS_CLOCK_FREQ_MHZ
+lines.append("")
+if main_clock_domain is not None:
+    lines.append(f"#define MAIN_CLOCK_FREQ_MHZ {main_clock_domain}")
+for name, clock_domain in zip(mainbus_names, mainbus_clock_domains):
+    lines.append(f"#define {name.upper()}_CLOCK_FREQ_MHZ {clock_domain}")
+
+# System cache geometry, the line length is converted from 32-bit words to bytes
+if cache_geometry:
+    lines.append("")
+    if 'CACHE_SIZE' in cache_geometry:
+        lines.append(f"#define SYSCACHE_SIZE {cache_geometry['CACHE_SIZE']}")
+    if 'CACHE_NUM_WAYS' in cache_geometry:
+        lines.append(f"#define SYSCACHE_NUM_WAYS {cache_geometry['CACHE_NUM_WAYS']}")
+    if 'CACHE_LINE_LENGTH' in cache_geometry:
+        lines.append(f"#define SYSCACHE_LINE_SIZE {cache_geometry['CACHE_LINE_LENGTH'] * 4}")
+
 lines.append("")
 lines.append(f"#endif // {include_guard}")
 
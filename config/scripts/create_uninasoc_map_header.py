@@ -0,0 +1,137 @@
+#!/bin/python3.10
+# Description:
+#   Generate the memory map header of the HAL (uninasoc_map.h) from the CSV configuration:
+#   base address, size and clock frequency of every address range (RANGE_NAMES) of the buses.
+#   The header is valid for C, assembly and linker scripts (MAP_<NAME>_* macros, plain integer
+#   literals), and for C++ (a constexpr range per device in namespace uninasoc::map).
+# Note:
+#   Ranges are named as in the linker script (create_linker_script.py), in upper case.
+#   Bus ranges (the last three chars are BUS) are kept for the main bus only, since the
+#   other buses use them to address back the main bus.
+#   Ranges of the PBUS and HBUS run in the clock domain of their bus on the main bus.
+# Args:
+#   1-3: Input configuration files (MBUS, PBUS, HBUS)
+#   4: Output generated header
+
+####################
+# Import libraries #
+####################
+# Parse args
+import sys
+# For basename
+import os
+# Manipulate CSV
+import pandas as pd
+
+##############
+# Parse args #
+##############
+
+# CSV configuration file path
+config_file_names = [
+		'config/configs/embedded/config_main_bus.csv',
+		'config/configs/embedded/config_peripheral_bus.csv',
+		'config/configs/embedded/config_highperformance_bus.csv',
+	]
+
+if len(sys.argv) >= len(config_file_names)+1:
+	config_file_names = sys.argv[1:len(config_file_names)+1]
+
+# Target header file
+header_file_name = 'sw/SoC/lib/uninasoc/inc/uninasoc_map.h'
+if len(sys.argv) >= 5:
+	header_file_name = sys.argv[len(config_file_names)+1]
+
+# Bus names, in the same order of the configuration files
+bus_names = ["MBUS", "PBUS", "HBUS"]
+
+###############
+# Read config #
+###############
+
+# Clock frequency (MHz) of each bus, as seen from the main bus
+bus_clock_domains = {}
+
+ranges = []
+# For each bus
+for bus, name in zip(bus_names, config_file_names):
+	config_df = pd.read_csv(name, sep=",", index_col=0)
+
+	# Skip DISABLE buses
+	if config_df.loc["PROTOCOL"]["Value"] == "DISABLE":
+		continue
+
+	range_names = config_df.loc["RANGE_NAMES"]["Value"].split()
+	range_base_addr = config_df.loc["RANGE_BASE_ADDR"]["Value"].split()
+	range_addr_width = config_df.loc["RANGE_ADDR_WIDTH"]["Value"].split()
+
+	# Clock domains are only defined on the main bus
+	if bus == "MBUS":
+		main_clock_domain = int(config_df.loc["MAIN_CLOCK_DOMAIN"]["Value"])
+		range_clock_domains = [int(clock) for clock in config_df.loc["RANGE_CLOCK_DOMAINS"]["Value"].split()]
+		bus_clock_domains = {device: clock for device, clock in zip(range_names, range_clock_domains) if device[-3:] == "BUS"}
+	else:
+		range_clock_domains = [bus_clock_domains.get(bus, main_clock_domain)] * len(range_names)
+
+	for device, base, width, clock in zip(range_names, range_base_addr, range_addr_width, range_clock_domains):
+		if device[-3:] == "BUS" and bus != "MBUS":
+			continue
+		ranges.append({
+			'bus': bus,
+			'device': device.upper(),
+			'base': int(base, 16),
+			'size': 1 << int(width),
+			'clock': clock
+		})
+
+###################
+# Generate header #
+###################
+
+base_filename = os.path.basename(header_file_name).replace('.', '_').upper()
+include_guard = f"__{base_filename}__"
+
+lines = [
+	"// THIS FILE IS AUTOGENERATED, DON'T TOUCH!",
+	"// Generated with " + os.path.basename(__file__),
+	f"#ifndef {include_guard}",
+	f"#define {include_guard}",
+	"",
+]
+
+# C macros, also usable from assembly and linker scripts
+bus = None
+for r in ranges:
+	if r['bus'] != bus:
+		bus = r['bus']
+		lines.append(f"// {bus}")
+	lines.append(f"#define MAP_{r['device']}_BASEADDR 0x{r['base']:x}")
+	lines.append(f"#define MAP_{r['device']}_SIZE 0x{r['size']:x}")
+	lines.append(f"#define MAP_{r['device']}_CLOCK_FREQ_MHZ {r['clock']}")
+
+# C++ constants
+lines.append("")
+lines.append("#ifdef __cplusplus")
+lines.append("#include <cstddef>")
+lines.append("#include <cstdint>")
+lines.append("")
+lines.append("namespace uninasoc::map {")
+lines.append("")
+lines.append("struct range {")
+lines.append("    uintptr_t base;")
+lines.append("    size_t size;")
+lines.append("    unsigned clock_freq_mhz;")
+lines.append("};")
+lines.append("")
+for r in ranges:
+	lines.append(f"inline constexpr range {r['device']} = {{ MAP_{r['device']}_BASEADDR, MAP_{r['device']}_SIZE, MAP_{r['device']}_CLOCK_FREQ_MHZ }};")
+lines.append("")
+lines.append("} // namespace uninasoc::map")
+lines.append("#endif // __cplusplus")
+
+lines.append("")
+lines.append(f"#endif // {include_guard}")
+lines.append("")
+
+with open(header_file_name, 'w') as f:
+	f.write("\n".join(lines))
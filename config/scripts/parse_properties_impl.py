@@ -688,4 +688,28 @@ def parse_RANGE_CLOCK_DOMAINS(
 ):
 	values = [int(prop) for prop in property_value.split()]
 	config.RANGE_CLOCK_DOMAINS = values.copy()
-	return config
\ No newline at end of file
+	return config
+
+def parse_CACHE_SIZE(
+	config,
+	property_name : str,
+	property_value: str,
+):
+	config.CACHE_SIZE = int(property_value)
+	return config
+
+def parse_CACHE_NUM_WAYS(
+	config,
+	property_name : str,
+	property_value: str,
+):
+	config.CACHE_NUM_WAYS = int(property_value)
+	return config
+
+def parse_CACHE_LINE_LENGTH(
+	config,
+	property_name : str,
+	property_value: str,
+):
+	config.CACHE_LINE_LENGTH = int(property_value)
+	return config
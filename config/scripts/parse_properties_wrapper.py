@@ -41,7 +41,7 @@ def parse_property (
 		# Master SECURE Modes, Ranges' Base Address, Ranges' Width Acquisition
 		case "CORE_SELECTOR" | "VIO_RESETN_DEFAULT" | "XLEN" | "PHYSICAL_ADDR_WIDTH" | "STRATEGY" | "R_REGISTER" | "PROTOCOL" | "CONNECTIVITY_MODE" | \
 			"Slave_Priority" | "THREAD_ID_WIDTH" | "SINGLE_THREAD" | "BASE_ID" | "SECURE" | "RANGE_BASE_ADDR" | "RANGE_ADDR_WIDTH" | "RANGE_NAMES" | "MASTER_NAMES" | \
-			"MAIN_CLOCK_DOMAIN" | "RANGE_CLOCK_DOMAINS":
+			"MAIN_CLOCK_DOMAIN" | "RANGE_CLOCK_DOMAINS" | "CACHE_SIZE" | "CACHE_NUM_WAYS" | "CACHE_LINE_LENGTH":
 			func_name = base_func_name + property_name
 
 		# ID Width Acquisition
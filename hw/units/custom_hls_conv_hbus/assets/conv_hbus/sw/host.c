@@ -2,6 +2,7 @@
 // Description: Baremetal host code for conv_hbus HLS IP core.
 
 #include "uninasoc.h"
+#include "io.h"
 #include "xlnx/xlnx.h"
 #include "krnl_conv_hbus.h"
 #include "utils.h"
@@ -53,8 +54,61 @@ void print_control_csr ( uint32_t csr_read_in ) {
     printf("    INTERRUPT   =  0x%x\n\r", ( csr_read_in & AP_INTERRUPT) >> (AP_INTERRUPT_BIT));
 }
 
+// Read the lower 32 bits of the cycle counter
+static inline uint32_t read_mcycle () {
+    uintptr_t cycles;
+    asm volatile("csrr %0, mcycle" : "=r"(cycles));
+    return (uint32_t)cycles;
+}
+
+// Cost of the legacy launch sequence (driver.h macros, read-modify-write accesses).
+// Timed as the driver's launch_cycles: from the first argument write to after the
+// ap_start write, including the barrier before ap_start and the start timestamp.
+// The kernel must be idle: it runs once, and is waited for outside of the measurement.
+uint32_t measure_legacy_launch ( uintptr_t I, uintptr_t W, uintptr_t O ) {
+    uint32_t begin = read_mcycle();
+    XKrnl_InterruptGlobalEnable();
+    XKrnl_InterruptEnable_ap_done();
+    Xil_Out32(Xkrnl_AXI_ADDR_I, I);
+    Xil_Out32(Xkrnl_AXI_ADDR_W, W);
+    Xil_Out32(Xkrnl_AXI_ADDR_O, O);
+    Xil_Out32(Xkrnl_N, (uint8_t)N);
+    Xil_Out32(Xkrnl_C, (uint8_t)C);
+    Xil_Out32(Xkrnl_K, (uint8_t)K);
+    // Same as the driver's start_cycle stamp
+    volatile uint32_t start = read_mcycle();
+    (void)start;
+    io_wmb();
+    XKrnl_Start();
+    uint32_t cycles = read_mcycle() - begin;
+
+    while ( !XKrnl_IsIdle() );
+    return cycles;
+}
+
 #define PRINT_LEAP 10
 
+// Number of back-to-back jobs pushed through the driver queue
+#define NUM_JOBS 4
+
+// Accelerator driver instance
+hls_conv_t conv = {
+    .base_addr = HLS_CONTROL_BASEADDR
+};
+
+// Completed jobs, updated by the completion callback
+volatile uint32_t jobs_done = 0;
+
+// Job completion callback (runs in the external interrupt handler)
+void conv_done_callback ( void * arg ) {
+    (*(volatile uint32_t *)arg)++;
+}
+
+// HLS interrupt handler, dispatched by the default _ext_handler (plic_dispatch())
+void conv_irq_handler ( void * arg ) {
+    hls_conv_irq_handler((hls_conv_t *)arg);
+}
+
 int main() {
 
     // Control CSR
@@ -64,14 +118,45 @@ int main() {
     // Init platform
     uninasoc_init();
 
-    // Pre-allocate tensors, aligned to power of two
+    // Allocate tensors, aligned to power of two
     #define ALIGN_I 2048
     #define ALIGN_W 1024
     #define ALIGN_O 1024
-    target_type_t I       [N][C][ Y][ X]__attribute__((aligned(ALIGN_I)));
-    target_type_t W       [K][C][ R][ S]__attribute__((aligned(ALIGN_W)));
-    target_type_t O       [N][K][Y1][X1]__attribute__((aligned(ALIGN_O)));
-    target_type_t expected[N][K][Y1][X1] = {0};
+    target_type_t (*I)       [C][ Y][ X];
+    target_type_t (*W)       [C][ R][ S];
+    target_type_t (*O)    [N][K][Y1][X1];
+    target_type_t (*expected)[K][Y1][X1];
+
+#ifdef DDR4CH1_IS_ENABLED
+    // Accelerator buffers live in DDR, leaving the BRAM to code and stack.
+    // The arena is carved out of the heap, which lives in DDR4CH1 after the cold sections
+    arena_t tensors;
+    size_t tensors_size = sizeof(target_type_t) * (SIZE_I + SIZE_W + SIZE_O * (NUM_JOBS + 1))
+                        + ALIGN_I + ALIGN_W + ALIGN_O + ARENA_ALIGN_WORD;
+    void * tensors_memory = malloc(tensors_size);
+    if ( tensors_memory == NULL || arena_init(&tensors, (uintptr_t)tensors_memory, tensors_size) != UNINASOC_OK ) {
+        printf("[ERROR] Tensor arena allocation failed!\n\r");
+        return 1;
+    }
+    I        = arena_alloc(&tensors, sizeof(target_type_t) * SIZE_I           , ALIGN_I);
+    W        = arena_alloc(&tensors, sizeof(target_type_t) * SIZE_W           , ALIGN_W);
+    O        = arena_alloc(&tensors, sizeof(target_type_t) * SIZE_O * NUM_JOBS, ALIGN_O);
+    expected = arena_alloc(&tensors, sizeof(target_type_t) * SIZE_O           , ARENA_ALIGN_WORD);
+    if ( I == NULL || W == NULL || O == NULL || expected == NULL ) {
+        printf("[ERROR] Tensor allocation failed!\n\r");
+        return 1;
+    }
+#else
+    static target_type_t I_buf       [N][C][ Y][ X]__attribute__((aligned(ALIGN_I)));
+    static target_type_t W_buf       [K][C][ R][ S]__attribute__((aligned(ALIGN_W)));
+    static target_type_t O_buf       [NUM_JOBS][N][K][Y1][X1]__attribute__((aligned(ALIGN_O)));
+    static target_type_t expected_buf[N][K][Y1][X1];
+    I        = I_buf;
+    W        = W_buf;
+    O        = O_buf;
+    expected = expected_buf;
+#endif
+    memset(expected, 0, sizeof(target_type_t) * SIZE_O);
 
     printf("\n\r");
     printf("------------------\n\r");
@@ -83,7 +168,7 @@ int main() {
     printf("Convolution parameters:\n\r");
     printf("    I = 0x%p\n\r", (uintptr_t)I);
     printf("    W = 0x%p\n\r", (uintptr_t)W);
-    printf("    O = 0x%p\n\r", (uintptr_t)O);
+    printf("    O = 0x%p (x%u jobs)\n\r", (uintptr_t)O, NUM_JOBS);
     printf("    N = %hhu\n\r", (uint8_t)N);
     printf("    C = %hhu\n\r", (uint8_t)C);
     printf("    K = %hhu\n\r", (uint8_t)K);
@@ -95,11 +180,9 @@ int main() {
     printf("   X1 = %hhu\n\r", (uint8_t) X1);
 
     // Initializing input/output data
-    init_data(I, W, O);
-
-    // Compute expected
-    printf("[INFO] Compute expected\n\r");
-    compute_expected(I, W, expected);
+    for ( uint32_t j = 0; j < NUM_JOBS; j++ ) {
+        init_data(I, W, O[j]);
+    }
 
     printf("[INFO] Waiting for idle...\n\r");
     // Reset counter
@@ -116,74 +199,86 @@ int main() {
             // Print
             print_control_csr(csr_read);
         }
-    } while ( XKrnl_IsIdle() );
+    } while ( !XKrnl_IsIdle() );
+
+    // Baseline MMIO cost of a launch, before the driver takes over (runs the kernel once on O[0])
+    uint32_t legacy_launch_cycles = measure_legacy_launch((uintptr_t)I, (uintptr_t)W, (uintptr_t)O[0]);
 
     ///////////////////////
     // Enable interrupts //
     ///////////////////////
-    // Global Interrupts Enable
-    XKrnl_InterruptGlobalEnable();
-    // Enable done and ready interrupts
-    XKrnl_InterruptEnable_ap_done();
-    // XKrnl_InterruptEnable_ap_ready();
+
+    // Route the HLS interrupt line through the PLIC
+    plic_init();
+    plic_register_handler(PLIC_HLS_INTERRUPT, conv_irq_handler, &conv, 1);
+
+    // Enable the ap_done interrupt
+    if ( hls_conv_init(&conv) != UNINASOC_OK ) {
+        printf("[ERROR] HLS driver init failed!\n\r");
+        return 1;
+    }
 
     /////////////////////////
     // Starting the kernel //
     /////////////////////////
 
-    // Writing input/output addresses
-    Xil_Out32(Xkrnl_AXI_ADDR_I, (uintptr_t)I);
-    Xil_Out32(Xkrnl_AXI_ADDR_W, (uintptr_t)W);
-    Xil_Out32(Xkrnl_AXI_ADDR_O, (uintptr_t)O);
-    Xil_Out32(Xkrnl_N, (uint8_t)N);
-    Xil_Out32(Xkrnl_C, (uint8_t)C);
-    Xil_Out32(Xkrnl_K, (uint8_t)K);
+    // Same input and weights, one output tensor per job
+    hls_conv_job_t jobs [NUM_JOBS];
+    printf("[INFO] Submitting %u jobs...\n\r", NUM_JOBS);
+    for ( uint32_t j = 0; j < NUM_JOBS; j++ ) {
+        jobs[j].input        = (uintptr_t)I;
+        jobs[j].weights      = (uintptr_t)W;
+        jobs[j].output       = (uintptr_t)O[j];
+        jobs[j].n            = (uint8_t)N;
+        jobs[j].c            = (uint8_t)C;
+        jobs[j].k            = (uint8_t)K;
+        jobs[j].callback     = conv_done_callback;
+        jobs[j].callback_arg = (void *)&jobs_done;
+        if ( hls_conv_submit(&conv, &jobs[j]) != UNINASOC_OK ) {
+            printf("[ERROR] Submit failed!\n\r");
+            return 1;
+        }
+    }
 
-    // Enable auto-restart
-    XKrnl_EnableAutoRestart();
-    // Raising ap_start to start the kernel
-    XKrnl_Start();
+    // Compute expected while the kernel runs
+    printf("[INFO] Compute expected\n\r");
+    compute_expected(I, W, expected);
 
-    // Waiting for the kernel to finish (polling the ap_done control bit)
+    // Sleep until the completion interrupt
     printf("[INFO] Waiting for done...\n\r");
-    // Reset counter
-    cnt = 0;
-    do {
-        // Increment counter
-        cnt++;
-        if ( cnt == PRINT_LEAP ) {
-            // Reset counter
-            cnt = 0;
-            // Read
-            csr_read = -1;
-            csr_read = Xil_In32(Xkrnl_Control);
-            // Print
-            print_control_csr(csr_read);
-        }
-    } while ( XKrnl_IsDone() );
+    hls_conv_wait(&conv);
+    printf("[INFO] Jobs completed: %u\n\r", jobs_done);
 
-    // Read pending interrupts
-    printf( "   ISR     = 0x%04x\n\r", XKrnl_InterruptGetStatus() );
-    // Clear interrupts
-    XKrnl_InterruptClear_ap_done();
-    // XKrnl_InterruptClear_ap_ready();
-    // Read pending interrupts
-    printf( "   ISR     = 0x%04x\n\r", XKrnl_InterruptGetStatus() );
+    // Queue statistics (core cycles)
+    for ( uint32_t j = 0; j < NUM_JOBS; j++ ) {
+        printf("    job %u: queued %u, run %u, latency %u\n\r", j,
+            jobs[j].start_cycle - jobs[j].submit_cycle,
+            jobs[j].done_cycle  - jobs[j].start_cycle,
+            jobs[j].done_cycle  - jobs[j].submit_cycle
+        );
+    }
+    printf("    max depth     = %u\n\r", conv.stats.max_depth);
+    printf("    max latency   = %u\n\r", conv.stats.max_latency);
+    printf("    avg latency   = %u\n\r", (uint32_t)(conv.stats.total_latency / conv.stats.jobs));
+    printf("    cycles/job    = %u\n\r", (conv.stats.last_done_cycle - conv.stats.first_start_cycle) / conv.stats.jobs);
 
-    // // Write continue
-    // XKrnl_Continue();
+    // Per-launch MMIO overhead, legacy macros vs. shadowed driver
+    printf("    launch cycles = %u (legacy) vs %u (driver)\n\r",
+        legacy_launch_cycles, conv.stats.launch_cycles / conv.stats.launches);
+    printf("    launch writes = 9 + 2 reads (legacy) vs %u (driver)\n\r",
+        conv.stats.mmio_writes / conv.stats.launches);
 
     // Checking results
     printf("[INFO] Checking results...\n\r");
-    bool result = check_values(O, expected);
-    if ( !result ) {
-        printf("[ERROR] Check failed!\n\r");
-        return 1;
-    }
-    else {
-        printf("[INFO] Check successful!\n\r");
+    for ( uint32_t j = 0; j < NUM_JOBS; j++ ) {
+        bool result = check_values(O[j], expected);
+        if ( !result ) {
+            printf("[ERROR] Check failed for job %u!\n\r", j);
+            return 1;
+        }
     }
+    printf("[INFO] Check successful!\n\r");
 
     return 0;
 
-}
\ No newline at end of file
+}
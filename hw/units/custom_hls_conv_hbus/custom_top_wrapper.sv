@@ -15,7 +15,7 @@ module custom_top_wrapper # (
     //  Add here IP-related parameters  //
     //////////////////////////////////////
     localparam LOCAL_AXI_DATA_WIDTH     = 512,
-    localparam LOCAL_AXI_ADDR_WIDTH     = 32,
+    localparam LOCAL_AXI_ADDR_WIDTH     = 64,
     localparam LOCAL_AXI_ID_WIDTH       = 4,
     localparam LOCAL_AXILITE_DATA_WIDTH = 32,
     localparam LOCAL_AXILITE_ADDR_WIDTH = 32,
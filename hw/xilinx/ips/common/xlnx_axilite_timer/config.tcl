@@ -8,7 +8,10 @@ set_property -dict [list \
                         CONFIG.TRIG0_ASSERT     {Active_High} \
                         CONFIG.TRIG1_ASSERT     {Active_High} \
                         CONFIG.enable_timer2    {1} \
-                        CONFIG.mode_64bit       {0} \
+                        CONFIG.mode_64bit       {1} \
                       ] [get_ips $::env(IP_NAME)]
 
 # Note: ADDR_WIDTH is fixed at 5 bits, DATA_WIDTH is fixed at 32
+# Note: mode_64bit enables the cascade mode (TCSR0.CASC) of the two counters, used by the
+#       64-bit clocksource (sw/SoC/lib/uninasoc/inc/clock.h). Each counter still works as a
+#       32-bit timer when the cascade mode is off
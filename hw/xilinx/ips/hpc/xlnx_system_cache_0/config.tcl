@@ -16,14 +16,23 @@ create_ip -name system_cache -vendor xilinx.com -library ip -version 5.0 -module
 # - Exclusive access support enabled (C_ENABLE_EXCLUSIVE = 1)
 # - Base address: Absolute address of start of cachable range
 # - High address: Absolute address of end of cachable range
-# - Cache line length: 32 bytes, constant for now
+# - Cache size, number of ways and line length (in 32-bit words) are set by the config flow
+#   from the MBUS CSV (CACHE_SIZE, CACHE_NUM_WAYS, CACHE_LINE_LENGTH)
 # - CCIX0 cache line size: 128 bytes, constant for now
+# - Control interface enabled (S_AXI_CTRL, C_ENABLE_CTRL = 1): cache maintenance by address
+#   (flush, invalidate), mapped on the MBUS as CACHE_CTRL through an AXI4-to-AXI-lite converter.
+#   - Control base address: Absolute address of CACHE_CTRL (128KB range)
+#   - Statistics enabled (C_ENABLE_STATISTICS = 1): hit/miss counters, read through the same
+#     control interface
 # - Other optional interfaces (ACE, CHI, CCIX, snoop, coherency, etc.) disabled
 
 # Set the cache BASEADDR and HIGHADDR
 # WARNING: Do not change the following line, it is modified by config-based script
 set CACHE_BASEADDR {0x40000}
 set CACHE_HIGHADDR {0x4ffff}
+# WARNING: Do not change the following line, it is modified by config-based script
+set CACHE_CTRL_BASEADDR {0x60000}
+set CACHE_CTRL_HIGHADDR {0x7ffff}
 
 set_property -dict [list \
   CONFIG.C_CACHE_LINE_LENGTH {32} \
@@ -50,8 +59,12 @@ set_property -dict [list \
   CONFIG.C_ENABLE_INTEGRITY {0} \
   CONFIG.C_ENABLE_NON_SECURE {0} \
   CONFIG.C_ENABLE_ERROR_HANDLING {0} \
-  CONFIG.C_ENABLE_CTRL {0} \
-  CONFIG.C_ENABLE_STATISTICS {0} \
+  CONFIG.C_ENABLE_CTRL {1} \
+  CONFIG.C_S_AXI_CTRL_BASEADDR $CACHE_CTRL_BASEADDR \
+  CONFIG.C_S_AXI_CTRL_HIGHADDR $CACHE_CTRL_HIGHADDR \
+  CONFIG.C_S_AXI_CTRL_ADDR_WIDTH $::env(MBUS_ADDR_WIDTH) \
+  CONFIG.C_S_AXI_CTRL_DATA_WIDTH {32} \
+  CONFIG.C_ENABLE_STATISTICS {1} \
   CONFIG.C_ENABLE_VERSION_REGISTER {0} \
   CONFIG.C_ENABLE_INTERRUPT {0} \
   CONFIG.C_ENABLE_ADDRESS_TRANSLATION {0} \
@@ -23,13 +23,23 @@ BIN_PATH ?= ${SW_ROOT}/SoC/examples/${EXAMPLE}/bin/${EXAMPLE}.bin
 BASE_ADDRESS ?= 0x00000000
 # Whether to readback and check the loaded binary or not
 LOAD_BINARY_READBACK ?= false
+# Cold section image (libuninasoc section.h, e.g. in DDR) and its load address, both from the
+# software build. Written before the boot memory image, skipped if empty
+COLD_BIN_PATH ?= $(basename ${BIN_PATH})_cold.bin
+COLD_BASE_ADDRESS ?= $(shell cat $(basename ${BIN_PATH})_cold.addr 2>/dev/null)
 
-# Load the binary into SoC memory (BRAM for now)
+# Load the binary into SoC memory (BRAM, and the cold section if any)
 # Call the specific load script based on the SOC_CONFIG (HPC or EMBEDDED)
 load_binary: load_binary_${SOC_CONFIG}
 
 # Write the binary to BRAM through jtag2axi
 load_binary_embedded: ${BIN_PATH}
+	@if [ -s ${COLD_BIN_PATH} ]; then \
+		${XILINX_VIVADO} \
+			-source ${XILINX_SCRIPT_ROOT}/utils/open_hw_manager.tcl \
+			-source ${XILINX_SCRIPTS_LOAD_ROOT}/jtag2axi_load_binary.tcl \
+			-tclargs ${COLD_BIN_PATH} ${COLD_BASE_ADDRESS} ${LOAD_BINARY_READBACK} || exit 1; \
+	fi
 	${XILINX_VIVADO} \
 		-source ${XILINX_SCRIPT_ROOT}/utils/open_hw_manager.tcl \
 		-source ${XILINX_SCRIPTS_LOAD_ROOT}/jtag2axi_load_binary.tcl \
@@ -37,7 +47,11 @@ load_binary_embedded: ${BIN_PATH}
 
 # Write the binary to BRAM/DDR through XDMA
 load_binary_hpc: ${BIN_PATH}
-	@bash -c "source ${XILINX_SCRIPTS_LOAD_ROOT}/xdma_load_binary.sh
+	@if [ -s ${COLD_BIN_PATH} ]; then \
+		bash -c "source ${XILINX_SCRIPTS_LOAD_ROOT}/xdma_load_binary.sh \
+			${PCIE_BAR} ${COLD_BIN_PATH} ${COLD_BASE_ADDRESS} ${LOAD_BINARY_READBACK}" || exit 1; \
+	fi
+	@bash -c "source ${XILINX_SCRIPTS_LOAD_ROOT}/xdma_load_binary.sh \
 		${PCIE_BAR} ${BIN_PATH} ${BASE_ADDRESS} ${LOAD_BINARY_READBACK}"
 
 ######################
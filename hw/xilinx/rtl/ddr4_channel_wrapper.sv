@@ -3,7 +3,8 @@
 // Description: This module is a wrapper for a single DDR4 channel.
 //              It includes :
 //                 - A clock converter to increase the frequency to 300 MHz
-//                 - An optional System Cache (enabled if ENABLE_CACHE=1)
+//                 - An optional System Cache (enabled if ENABLE_CACHE=1), with its control interface
+//                   (s_cache_ctrl, cache maintenance and statistics) behind a protocol converter
 //                 - A datawidth converter to increase the datawidth to 512 bit (enabled if ENABLE_CACHE=0)
 //                 - A DDR4 (MIG) IP
 //
@@ -52,6 +53,9 @@ module ddr4_channel_wrapper # (
     // AXI-lite CSR interface
     `DEFINE_AXILITE_SLAVE_PORTS(s_ctrl, LOCAL_DATA_WIDTH, LOCAL_ADDR_WIDTH, LOCAL_ID_WIDTH),
 
+    // AXI4 System Cache control interface (ENABLE_CACHE=1, every access is answered with DECERR otherwise)
+    `DEFINE_AXI_SLAVE_PORTS(s_cache_ctrl, LOCAL_DATA_WIDTH, LOCAL_ADDR_WIDTH, LOCAL_ID_WIDTH),
+
     // AXI4 Slave interface
     `DEFINE_AXI_SLAVE_PORTS(s, LOCAL_DATA_WIDTH, LOCAL_ADDR_WIDTH, LOCAL_ID_WIDTH)
 
@@ -88,11 +92,194 @@ module ddr4_channel_wrapper # (
     generate
     if (ENABLE_CACHE == 1 ) begin : with_cache
 
+            // Cache control bus, 32-bit AXI4 and AXI-lite
+            `DECLARE_AXI_BUS(d32_cache_ctrl, 32, LOCAL_ADDR_WIDTH, LOCAL_ID_WIDTH)
+            `DECLARE_AXILITE_BUS(cache_ctrl, 32, LOCAL_ADDR_WIDTH, LOCAL_ID_WIDTH)
+
+            // Use a Dwidth converter if System XLEN is 64-bits wide.
+            if ( LOCAL_DATA_WIDTH == 64 ) begin : gen_ctrl_dwidth_conv
+
+                xlnx_axi_dwidth_64_to_32_converter ctrl_dwidth_conv_u (
+                    .s_axi_aclk     ( clock_i                     ),
+                    .s_axi_aresetn  ( reset_ni                    ),
+
+                    // Slave from MBUS
+                    .s_axi_awid     ( s_cache_ctrl_axi_awid       ),
+                    .s_axi_awaddr   ( s_cache_ctrl_axi_awaddr     ),
+                    .s_axi_awlen    ( s_cache_ctrl_axi_awlen      ),
+                    .s_axi_awsize   ( s_cache_ctrl_axi_awsize     ),
+                    .s_axi_awburst  ( s_cache_ctrl_axi_awburst    ),
+                    .s_axi_awvalid  ( s_cache_ctrl_axi_awvalid    ),
+                    .s_axi_awready  ( s_cache_ctrl_axi_awready    ),
+                    .s_axi_wdata    ( s_cache_ctrl_axi_wdata      ),
+                    .s_axi_wstrb    ( s_cache_ctrl_axi_wstrb      ),
+                    .s_axi_wlast    ( s_cache_ctrl_axi_wlast      ),
+                    .s_axi_wvalid   ( s_cache_ctrl_axi_wvalid     ),
+                    .s_axi_wready   ( s_cache_ctrl_axi_wready     ),
+                    .s_axi_bid      ( s_cache_ctrl_axi_bid        ),
+                    .s_axi_bresp    ( s_cache_ctrl_axi_bresp      ),
+                    .s_axi_bvalid   ( s_cache_ctrl_axi_bvalid     ),
+                    .s_axi_bready   ( s_cache_ctrl_axi_bready     ),
+                    .s_axi_arid     ( s_cache_ctrl_axi_arid       ),
+                    .s_axi_araddr   ( s_cache_ctrl_axi_araddr     ),
+                    .s_axi_arlen    ( s_cache_ctrl_axi_arlen      ),
+                    .s_axi_arsize   ( s_cache_ctrl_axi_arsize     ),
+                    .s_axi_arburst  ( s_cache_ctrl_axi_arburst    ),
+                    .s_axi_arvalid  ( s_cache_ctrl_axi_arvalid    ),
+                    .s_axi_arready  ( s_cache_ctrl_axi_arready    ),
+                    .s_axi_rid      ( s_cache_ctrl_axi_rid        ),
+                    .s_axi_rdata    ( s_cache_ctrl_axi_rdata      ),
+                    .s_axi_rresp    ( s_cache_ctrl_axi_rresp      ),
+                    .s_axi_rlast    ( s_cache_ctrl_axi_rlast      ),
+                    .s_axi_rvalid   ( s_cache_ctrl_axi_rvalid     ),
+                    .s_axi_rready   ( s_cache_ctrl_axi_rready     ),
+                    .s_axi_awlock   ( s_cache_ctrl_axi_awlock     ),
+                    .s_axi_awcache  ( s_cache_ctrl_axi_awcache    ),
+                    .s_axi_awprot   ( s_cache_ctrl_axi_awprot     ),
+                    .s_axi_awqos    ( s_cache_ctrl_axi_awqos      ),
+                    .s_axi_awregion ( s_cache_ctrl_axi_awregion   ),
+                    .s_axi_arlock   ( s_cache_ctrl_axi_arlock     ),
+                    .s_axi_arcache  ( s_cache_ctrl_axi_arcache    ),
+                    .s_axi_arprot   ( s_cache_ctrl_axi_arprot     ),
+                    .s_axi_arqos    ( s_cache_ctrl_axi_arqos      ),
+                    .s_axi_arregion ( s_cache_ctrl_axi_arregion   ),
+
+                    // Master to Protocol Converter
+                    .m_axi_awaddr   ( d32_cache_ctrl_axi_awaddr   ),
+                    .m_axi_awlen    ( d32_cache_ctrl_axi_awlen    ),
+                    .m_axi_awsize   ( d32_cache_ctrl_axi_awsize   ),
+                    .m_axi_awburst  ( d32_cache_ctrl_axi_awburst  ),
+                    .m_axi_awlock   ( d32_cache_ctrl_axi_awlock   ),
+                    .m_axi_awcache  ( d32_cache_ctrl_axi_awcache  ),
+                    .m_axi_awprot   ( d32_cache_ctrl_axi_awprot   ),
+                    .m_axi_awqos    ( d32_cache_ctrl_axi_awqos    ),
+                    .m_axi_awvalid  ( d32_cache_ctrl_axi_awvalid  ),
+                    .m_axi_awready  ( d32_cache_ctrl_axi_awready  ),
+                    .m_axi_wdata    ( d32_cache_ctrl_axi_wdata    ),
+                    .m_axi_wstrb    ( d32_cache_ctrl_axi_wstrb    ),
+                    .m_axi_wlast    ( d32_cache_ctrl_axi_wlast    ),
+                    .m_axi_wvalid   ( d32_cache_ctrl_axi_wvalid   ),
+                    .m_axi_wready   ( d32_cache_ctrl_axi_wready   ),
+                    .m_axi_bresp    ( d32_cache_ctrl_axi_bresp    ),
+                    .m_axi_bvalid   ( d32_cache_ctrl_axi_bvalid   ),
+                    .m_axi_bready   ( d32_cache_ctrl_axi_bready   ),
+                    .m_axi_araddr   ( d32_cache_ctrl_axi_araddr   ),
+                    .m_axi_arlen    ( d32_cache_ctrl_axi_arlen    ),
+                    .m_axi_arsize   ( d32_cache_ctrl_axi_arsize   ),
+                    .m_axi_arburst  ( d32_cache_ctrl_axi_arburst  ),
+                    .m_axi_arlock   ( d32_cache_ctrl_axi_arlock   ),
+                    .m_axi_arcache  ( d32_cache_ctrl_axi_arcache  ),
+                    .m_axi_arprot   ( d32_cache_ctrl_axi_arprot   ),
+                    .m_axi_arqos    ( d32_cache_ctrl_axi_arqos    ),
+                    .m_axi_arvalid  ( d32_cache_ctrl_axi_arvalid  ),
+                    .m_axi_arready  ( d32_cache_ctrl_axi_arready  ),
+                    .m_axi_rdata    ( d32_cache_ctrl_axi_rdata    ),
+                    .m_axi_rresp    ( d32_cache_ctrl_axi_rresp    ),
+                    .m_axi_rlast    ( d32_cache_ctrl_axi_rlast    ),
+                    .m_axi_rvalid   ( d32_cache_ctrl_axi_rvalid   ),
+                    .m_axi_rready   ( d32_cache_ctrl_axi_rready   )
+                );
+
+                // Since the AXI data width converter has a reordering depth of 1 it doesn't have ID in its master ports - for more details see the documentation
+                assign d32_cache_ctrl_axi_awid = '0;
+                assign d32_cache_ctrl_axi_arid = '0;
+
+            end : gen_ctrl_dwidth_conv
+            else begin : no_ctrl_dwidth_conv
+
+                // Pass through
+                `ASSIGN_AXI_BUS (d32_cache_ctrl, s_cache_ctrl)
+
+            end : no_ctrl_dwidth_conv
+
+            // AXI converter for the cache control interface
+            xlnx_axi4_to_axilite_d32_converter ctrl_axi4_to_axilite_u (
+                // Clock and reset
+                .aclk               ( clock_i                       ),
+                .aresetn            ( reset_ni                      ),
+                // Slave interface
+                .s_axi_awid         ( d32_cache_ctrl_axi_awid       ),
+                .s_axi_awaddr       ( d32_cache_ctrl_axi_awaddr     ),
+                .s_axi_awlen        ( d32_cache_ctrl_axi_awlen      ),
+                .s_axi_awsize       ( d32_cache_ctrl_axi_awsize     ),
+                .s_axi_awburst      ( d32_cache_ctrl_axi_awburst    ),
+                .s_axi_awlock       ( d32_cache_ctrl_axi_awlock     ),
+                .s_axi_awcache      ( d32_cache_ctrl_axi_awcache    ),
+                .s_axi_awprot       ( d32_cache_ctrl_axi_awprot     ),
+                .s_axi_awregion     ( d32_cache_ctrl_axi_awregion   ),
+                .s_axi_awqos        ( d32_cache_ctrl_axi_awqos      ),
+                .s_axi_awvalid      ( d32_cache_ctrl_axi_awvalid    ),
+                .s_axi_awready      ( d32_cache_ctrl_axi_awready    ),
+                .s_axi_wdata        ( d32_cache_ctrl_axi_wdata      ),
+                .s_axi_wstrb        ( d32_cache_ctrl_axi_wstrb      ),
+                .s_axi_wlast        ( d32_cache_ctrl_axi_wlast      ),
+                .s_axi_wvalid       ( d32_cache_ctrl_axi_wvalid     ),
+                .s_axi_wready       ( d32_cache_ctrl_axi_wready     ),
+                .s_axi_bid          ( d32_cache_ctrl_axi_bid        ),
+                .s_axi_bresp        ( d32_cache_ctrl_axi_bresp      ),
+                .s_axi_bvalid       ( d32_cache_ctrl_axi_bvalid     ),
+                .s_axi_bready       ( d32_cache_ctrl_axi_bready     ),
+                .s_axi_arid         ( d32_cache_ctrl_axi_arid       ),
+                .s_axi_araddr       ( d32_cache_ctrl_axi_araddr     ),
+                .s_axi_arlen        ( d32_cache_ctrl_axi_arlen      ),
+                .s_axi_arsize       ( d32_cache_ctrl_axi_arsize     ),
+                .s_axi_arburst      ( d32_cache_ctrl_axi_arburst    ),
+                .s_axi_arlock       ( d32_cache_ctrl_axi_arlock     ),
+                .s_axi_arcache      ( d32_cache_ctrl_axi_arcache    ),
+                .s_axi_arprot       ( d32_cache_ctrl_axi_arprot     ),
+                .s_axi_arregion     ( d32_cache_ctrl_axi_arregion   ),
+                .s_axi_arqos        ( d32_cache_ctrl_axi_arqos      ),
+                .s_axi_arvalid      ( d32_cache_ctrl_axi_arvalid    ),
+                .s_axi_arready      ( d32_cache_ctrl_axi_arready    ),
+                .s_axi_rid          ( d32_cache_ctrl_axi_rid        ),
+                .s_axi_rdata        ( d32_cache_ctrl_axi_rdata      ),
+                .s_axi_rresp        ( d32_cache_ctrl_axi_rresp      ),
+                .s_axi_rlast        ( d32_cache_ctrl_axi_rlast      ),
+                .s_axi_rvalid       ( d32_cache_ctrl_axi_rvalid     ),
+                .s_axi_rready       ( d32_cache_ctrl_axi_rready     ),
+                // Master interface
+                .m_axi_awaddr       ( cache_ctrl_axilite_awaddr     ),
+                .m_axi_awprot       ( cache_ctrl_axilite_awprot     ),
+                .m_axi_awvalid      ( cache_ctrl_axilite_awvalid    ),
+                .m_axi_awready      ( cache_ctrl_axilite_awready    ),
+                .m_axi_wdata        ( cache_ctrl_axilite_wdata      ),
+                .m_axi_wstrb        ( cache_ctrl_axilite_wstrb      ),
+                .m_axi_wvalid       ( cache_ctrl_axilite_wvalid     ),
+                .m_axi_wready       ( cache_ctrl_axilite_wready     ),
+                .m_axi_bresp        ( cache_ctrl_axilite_bresp      ),
+                .m_axi_bvalid       ( cache_ctrl_axilite_bvalid     ),
+                .m_axi_bready       ( cache_ctrl_axilite_bready     ),
+                .m_axi_araddr       ( cache_ctrl_axilite_araddr     ),
+                .m_axi_arprot       ( cache_ctrl_axilite_arprot     ),
+                .m_axi_arvalid      ( cache_ctrl_axilite_arvalid    ),
+                .m_axi_arready      ( cache_ctrl_axilite_arready    ),
+                .m_axi_rdata        ( cache_ctrl_axilite_rdata      ),
+                .m_axi_rresp        ( cache_ctrl_axilite_rresp      ),
+                .m_axi_rvalid       ( cache_ctrl_axilite_rvalid     ),
+                .m_axi_rready       ( cache_ctrl_axilite_rready     )
+            );
+
             xlnx_system_cache_0 system_cache_u (
 
                 .ACLK               ( clock_i                 ), // input wire ACLK
                 .ARESETN            ( reset_ni                ), // input wire ARESETN
                 .Initializing       ( /* empty */             ), // output wire Initializing
+                .S_AXI_CTRL_AWVALID ( cache_ctrl_axilite_awvalid ), // input wire S_AXI_CTRL_AWVALID
+                .S_AXI_CTRL_AWREADY ( cache_ctrl_axilite_awready ), // output wire S_AXI_CTRL_AWREADY
+                .S_AXI_CTRL_AWADDR  ( cache_ctrl_axilite_awaddr  ), // input wire [31 : 0] S_AXI_CTRL_AWADDR
+                .S_AXI_CTRL_WVALID  ( cache_ctrl_axilite_wvalid  ), // input wire S_AXI_CTRL_WVALID
+                .S_AXI_CTRL_WREADY  ( cache_ctrl_axilite_wready  ), // output wire S_AXI_CTRL_WREADY
+                .S_AXI_CTRL_WDATA   ( cache_ctrl_axilite_wdata   ), // input wire [31 : 0] S_AXI_CTRL_WDATA
+                .S_AXI_CTRL_BRESP   ( cache_ctrl_axilite_bresp   ), // output wire [1 : 0] S_AXI_CTRL_BRESP
+                .S_AXI_CTRL_BVALID  ( cache_ctrl_axilite_bvalid  ), // output wire S_AXI_CTRL_BVALID
+                .S_AXI_CTRL_BREADY  ( cache_ctrl_axilite_bready  ), // input wire S_AXI_CTRL_BREADY
+                .S_AXI_CTRL_ARVALID ( cache_ctrl_axilite_arvalid ), // input wire S_AXI_CTRL_ARVALID
+                .S_AXI_CTRL_ARREADY ( cache_ctrl_axilite_arready ), // output wire S_AXI_CTRL_ARREADY
+                .S_AXI_CTRL_ARADDR  ( cache_ctrl_axilite_araddr  ), // input wire [31 : 0] S_AXI_CTRL_ARADDR
+                .S_AXI_CTRL_RVALID  ( cache_ctrl_axilite_rvalid  ), // output wire S_AXI_CTRL_RVALID
+                .S_AXI_CTRL_RREADY  ( cache_ctrl_axilite_rready  ), // input wire S_AXI_CTRL_RREADY
+                .S_AXI_CTRL_RDATA   ( cache_ctrl_axilite_rdata   ), // output wire [31 : 0] S_AXI_CTRL_RDATA
+                .S_AXI_CTRL_RRESP   ( cache_ctrl_axilite_rresp   ), // output wire [1 : 0] S_AXI_CTRL_RRESP
                 .S0_AXI_GEN_AWID    ( s_axi_awid              ), // input wire [2 : 0] S0_AXI_GEN_AWID
                 .S0_AXI_GEN_AWADDR  ( s_axi_awaddr            ), // input wire [31 : 0] S0_AXI_GEN_AWADDR
                 .S0_AXI_GEN_AWLEN   ( s_axi_awlen             ), // input wire [7 : 0] S0_AXI_GEN_AWLEN
@@ -173,6 +360,73 @@ module ddr4_channel_wrapper # (
 
     end else begin : no_cache
 
+        // No cache control interface: CACHE_CTRL is still mapped on the MBUS, so every access
+        // is completed with a decode error (one transaction at a time) instead of stalling the bus
+        localparam logic [1:0] AXI_RESP_DECERR = 2'b11;
+
+        logic                      ctrl_wr_busy;   // AW accepted, W beats being drained
+        logic                      ctrl_bvalid;
+        logic [LOCAL_ID_WIDTH-1:0] ctrl_bid;
+        logic                      ctrl_rvalid;
+        logic [LOCAL_ID_WIDTH-1:0] ctrl_rid;
+        logic [7:0]                ctrl_rbeats;    // Beats left after the current one
+
+        always_ff @( posedge clock_i or negedge reset_ni ) begin
+            if ( !reset_ni ) begin
+                ctrl_wr_busy <= 1'b0;
+                ctrl_bvalid  <= 1'b0;
+                ctrl_bid     <= '0;
+            end
+            else begin
+                if ( s_cache_ctrl_axi_awvalid && s_cache_ctrl_axi_awready ) begin
+                    ctrl_wr_busy <= 1'b1;
+                    ctrl_bid     <= s_cache_ctrl_axi_awid;
+                end
+                if ( s_cache_ctrl_axi_wvalid && s_cache_ctrl_axi_wready && s_cache_ctrl_axi_wlast ) begin
+                    ctrl_wr_busy <= 1'b0;
+                    ctrl_bvalid  <= 1'b1;
+                end
+                if ( ctrl_bvalid && s_cache_ctrl_axi_bready ) begin
+                    ctrl_bvalid <= 1'b0;
+                end
+            end
+        end
+
+        always_ff @( posedge clock_i or negedge reset_ni ) begin
+            if ( !reset_ni ) begin
+                ctrl_rvalid <= 1'b0;
+                ctrl_rid    <= '0;
+                ctrl_rbeats <= '0;
+            end
+            else begin
+                if ( s_cache_ctrl_axi_arvalid && s_cache_ctrl_axi_arready ) begin
+                    ctrl_rvalid <= 1'b1;
+                    ctrl_rid    <= s_cache_ctrl_axi_arid;
+                    ctrl_rbeats <= s_cache_ctrl_axi_arlen;
+                end
+                else if ( ctrl_rvalid && s_cache_ctrl_axi_rready ) begin
+                    if ( ctrl_rbeats == '0 ) begin
+                        ctrl_rvalid <= 1'b0;
+                    end
+                    else begin
+                        ctrl_rbeats <= ctrl_rbeats - 1;
+                    end
+                end
+            end
+        end
+
+        assign s_cache_ctrl_axi_awready = !ctrl_wr_busy && !ctrl_bvalid;
+        assign s_cache_ctrl_axi_wready  = ctrl_wr_busy;
+        assign s_cache_ctrl_axi_bid     = ctrl_bid;
+        assign s_cache_ctrl_axi_bresp   = AXI_RESP_DECERR;
+        assign s_cache_ctrl_axi_bvalid  = ctrl_bvalid;
+        assign s_cache_ctrl_axi_arready = !ctrl_rvalid;
+        assign s_cache_ctrl_axi_rid     = ctrl_rid;
+        assign s_cache_ctrl_axi_rdata   = '0;
+        assign s_cache_ctrl_axi_rresp   = AXI_RESP_DECERR;
+        assign s_cache_ctrl_axi_rlast   = ctrl_rvalid && ( ctrl_rbeats == '0 );
+        assign s_cache_ctrl_axi_rvalid  = ctrl_rvalid;
+
         // Dwidth converter master ID signals assigned to 0
         // Since the AXI data width converter has a reordering depth of 1 it doesn't have ID in its master ports - for more details see the documentation
         // Thus, we assign 0 to all these signals that go to the clock converter
@@ -69,6 +69,11 @@ module hls_conv2d_wrapper # (
     // HLS interrupt line (not synchronized to MBUS)
     logic hls_interrupt_async;
 
+    // HLS IP master addresses (full 64-bit m_axi pointers)
+    localparam int unsigned HLS_GMEM_ADDR_WIDTH = 64;
+    logic [HLS_GMEM_ADDR_WIDTH-1:0] HLS_gmem0_awaddr;
+    logic [HLS_GMEM_ADDR_WIDTH-1:0] HLS_gmem0_araddr;
+
     // axi_clock_converter_u -> axi_dwidth_conv_u
     `DECLARE_AXI_BUS(sync_HLS_CONTROL, MBUS_DATA_WIDTH, MBUS_ADDR_WIDTH, MBUS_ID_WIDTH);
 
@@ -370,7 +375,7 @@ module hls_conv2d_wrapper # (
         .interrupt_o                ( hls_interrupt_async          ), // output wire interrupt_o
         // AXI4 Master
         .gmem0_axi_awid             ( m_HLS_gmem0_d512_axi_awid      ),
-        .gmem0_axi_awaddr           ( m_HLS_gmem0_d512_axi_awaddr    ),
+        .gmem0_axi_awaddr           ( HLS_gmem0_awaddr               ),
         .gmem0_axi_awlen            ( m_HLS_gmem0_d512_axi_awlen     ),
         .gmem0_axi_awsize           ( m_HLS_gmem0_d512_axi_awsize    ),
         .gmem0_axi_awburst          ( m_HLS_gmem0_d512_axi_awburst   ),
@@ -390,7 +395,7 @@ module hls_conv2d_wrapper # (
         .gmem0_axi_bresp            ( m_HLS_gmem0_d512_axi_bresp     ),
         .gmem0_axi_bvalid           ( m_HLS_gmem0_d512_axi_bvalid    ),
         .gmem0_axi_bready           ( m_HLS_gmem0_d512_axi_bready    ),
-        .gmem0_axi_araddr           ( m_HLS_gmem0_d512_axi_araddr    ),
+        .gmem0_axi_araddr           ( HLS_gmem0_araddr               ),
         .gmem0_axi_arlen            ( m_HLS_gmem0_d512_axi_arlen     ),
         .gmem0_axi_arsize           ( m_HLS_gmem0_d512_axi_arsize    ),
         .gmem0_axi_arburst          ( m_HLS_gmem0_d512_axi_arburst   ),
@@ -430,4 +435,9 @@ module hls_conv2d_wrapper # (
         .control_axilite_rready     ( HLS_CONTROL_axilite_rready   )  // input wire control_axilite_rready
     );
 
+    // Keep the HBUS address width (PHYSICAL_ADDR_WIDTH), so that buffers above 4 GB
+    // are reachable when PHYSICAL_ADDR_WIDTH > 32
+    assign m_HLS_gmem0_d512_axi_awaddr = HLS_gmem0_awaddr[HBUS_ADDR_WIDTH-1:0];
+    assign m_HLS_gmem0_d512_axi_araddr = HLS_gmem0_araddr[HBUS_ADDR_WIDTH-1:0];
+
 endmodule : hls_conv2d_wrapper
\ No newline at end of file
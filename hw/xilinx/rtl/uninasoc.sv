@@ -14,8 +14,9 @@
 //  |____________|                                    |          |                    ___________
 //   ______________                                   |          |                   |           |
 //  |              |--------------------------------->|          |------------------>|  DDR4CH1  |
-//  | Debug Module |                                  |   Main   |                   |___________|
-//  |______________|<---------------------------------|   Bus    |                    __________________
+//  | Debug Module |                                  |   Main   |------------------>|  + cache  |
+//  |______________|<---------------------------------|   Bus    |    CACHE_CTRL     |___________|
+//                                                    |          |                    __________________
 //                                                    |  (MBUS)  |                   |                  |
 //                                                    |          |------------------>| High-performance |
 //                                                    |          |                   |       bus        |<------\
@@ -756,6 +757,47 @@ module uninasoc (
         .s_ctrl_axilite_rdata    (       ),
         .s_ctrl_axilite_rresp    (       ),
 
+        // System cache control interface (maintenance and statistics)
+        .s_cache_ctrl_axi_awid     ( MBUS_to_CACHE_CTRL_axi_awid     ),
+        .s_cache_ctrl_axi_awaddr   ( MBUS_to_CACHE_CTRL_axi_awaddr   ),
+        .s_cache_ctrl_axi_awlen    ( MBUS_to_CACHE_CTRL_axi_awlen    ),
+        .s_cache_ctrl_axi_awsize   ( MBUS_to_CACHE_CTRL_axi_awsize   ),
+        .s_cache_ctrl_axi_awburst  ( MBUS_to_CACHE_CTRL_axi_awburst  ),
+        .s_cache_ctrl_axi_awlock   ( MBUS_to_CACHE_CTRL_axi_awlock   ),
+        .s_cache_ctrl_axi_awcache  ( MBUS_to_CACHE_CTRL_axi_awcache  ),
+        .s_cache_ctrl_axi_awprot   ( MBUS_to_CACHE_CTRL_axi_awprot   ),
+        .s_cache_ctrl_axi_awregion ( MBUS_to_CACHE_CTRL_axi_awregion ),
+        .s_cache_ctrl_axi_awqos    ( MBUS_to_CACHE_CTRL_axi_awqos    ),
+        .s_cache_ctrl_axi_awvalid  ( MBUS_to_CACHE_CTRL_axi_awvalid  ),
+        .s_cache_ctrl_axi_awready  ( MBUS_to_CACHE_CTRL_axi_awready  ),
+        .s_cache_ctrl_axi_wdata    ( MBUS_to_CACHE_CTRL_axi_wdata    ),
+        .s_cache_ctrl_axi_wstrb    ( MBUS_to_CACHE_CTRL_axi_wstrb    ),
+        .s_cache_ctrl_axi_wlast    ( MBUS_to_CACHE_CTRL_axi_wlast    ),
+        .s_cache_ctrl_axi_wvalid   ( MBUS_to_CACHE_CTRL_axi_wvalid   ),
+        .s_cache_ctrl_axi_wready   ( MBUS_to_CACHE_CTRL_axi_wready   ),
+        .s_cache_ctrl_axi_bid      ( MBUS_to_CACHE_CTRL_axi_bid      ),
+        .s_cache_ctrl_axi_bresp    ( MBUS_to_CACHE_CTRL_axi_bresp    ),
+        .s_cache_ctrl_axi_bvalid   ( MBUS_to_CACHE_CTRL_axi_bvalid   ),
+        .s_cache_ctrl_axi_bready   ( MBUS_to_CACHE_CTRL_axi_bready   ),
+        .s_cache_ctrl_axi_arid     ( MBUS_to_CACHE_CTRL_axi_arid     ),
+        .s_cache_ctrl_axi_araddr   ( MBUS_to_CACHE_CTRL_axi_araddr   ),
+        .s_cache_ctrl_axi_arlen    ( MBUS_to_CACHE_CTRL_axi_arlen    ),
+        .s_cache_ctrl_axi_arsize   ( MBUS_to_CACHE_CTRL_axi_arsize   ),
+        .s_cache_ctrl_axi_arburst  ( MBUS_to_CACHE_CTRL_axi_arburst  ),
+        .s_cache_ctrl_axi_arlock   ( MBUS_to_CACHE_CTRL_axi_arlock   ),
+        .s_cache_ctrl_axi_arcache  ( MBUS_to_CACHE_CTRL_axi_arcache  ),
+        .s_cache_ctrl_axi_arprot   ( MBUS_to_CACHE_CTRL_axi_arprot   ),
+        .s_cache_ctrl_axi_arregion ( MBUS_to_CACHE_CTRL_axi_arregion ),
+        .s_cache_ctrl_axi_arqos    ( MBUS_to_CACHE_CTRL_axi_arqos    ),
+        .s_cache_ctrl_axi_arvalid  ( MBUS_to_CACHE_CTRL_axi_arvalid  ),
+        .s_cache_ctrl_axi_arready  ( MBUS_to_CACHE_CTRL_axi_arready  ),
+        .s_cache_ctrl_axi_rid      ( MBUS_to_CACHE_CTRL_axi_rid      ),
+        .s_cache_ctrl_axi_rdata    ( MBUS_to_CACHE_CTRL_axi_rdata    ),
+        .s_cache_ctrl_axi_rresp    ( MBUS_to_CACHE_CTRL_axi_rresp    ),
+        .s_cache_ctrl_axi_rlast    ( MBUS_to_CACHE_CTRL_axi_rlast    ),
+        .s_cache_ctrl_axi_rvalid   ( MBUS_to_CACHE_CTRL_axi_rvalid   ),
+        .s_cache_ctrl_axi_rready   ( MBUS_to_CACHE_CTRL_axi_rready   ),
+
         // Slave interface
         .s_axi_awid           ( MBUS_to_DDR4CH1_axi_awid     ),
         .s_axi_awaddr         ( MBUS_to_DDR4CH1_axi_awaddr   ),
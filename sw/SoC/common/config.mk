@@ -1,20 +1,80 @@
 # Author: Stefano Mercogliano <stefano.mercogliano@unina.it>
 # Description:
 # 	It assigns the correct toolchain size depending on XLEN config parameter.
-#	XLEN is overwritten by `config/scripts/config_sw.sh`
+#	XLEN and CORE_SELECTOR are overwritten by `config/scripts/config_sw.sh`
+#	The build profile is selected with PROFILE (debug, release or size), e.g. `make PROFILE=release`
 
 #############
 # Toolchain #
 #############
 
 XLEN ?= 32
+CORE_SELECTOR ?= CORE_CV32E40P
 RV_PREFIX ?= riscv${XLEN}-unknown-elf-
 
 CC          = $(RV_PREFIX)gcc
-LD          = $(RV_PREFIX)ld
+CXX         = $(RV_PREFIX)g++
+LD          = $(RV_PREFIX)gcc
 OBJDUMP     = $(RV_PREFIX)objdump
 OBJCOPY     = $(RV_PREFIX)objcopy
-AR          = $(RV_PREFIX)ar
+NM          = $(RV_PREFIX)nm
+# gcc-ar indexes LTO objects too
+AR          = $(RV_PREFIX)gcc-ar
+SIZE        = $(RV_PREFIX)size
+
+#########
+# Cores #
+#########
+
+# ISA and pipeline tuning derived from the selected core
+# PicoRV32 is built without compressed instructions (COMPRESSED_ISA = 0 in custom_picorv32)
+ifeq ($(CORE_SELECTOR), CORE_PICORV32)
+CORE_ISA  := rv32im
+CORE_TUNE := sifive-3-series
+else ifeq ($(CORE_SELECTOR), CORE_IBEX)
+CORE_ISA  := rv32imc
+CORE_TUNE := sifive-3-series
+else ifeq ($(CORE_SELECTOR), CORE_CV32E40P)
+CORE_ISA  := rv32imc
+CORE_TUNE := sifive-3-series
+else ifeq ($(CORE_SELECTOR), CORE_MICROBLAZEV_RV32)
+CORE_ISA  := rv32imac
+CORE_TUNE := rocket
+else ifeq ($(CORE_SELECTOR), CORE_MICROBLAZEV_RV64)
+CORE_ISA  := rv64imac
+CORE_TUNE := rocket
+else ifeq ($(CORE_SELECTOR), CORE_CV64A6)
+CORE_ISA  := rv64imac
+CORE_TUNE := sifive-5-series
+else
+CORE_ISA  := rv${XLEN}imac
+CORE_TUNE := rocket
+endif
+
+MARCH ?= $(CORE_ISA)_zicsr_zifencei
+MTUNE ?= $(CORE_TUNE)
+
+############
+# Profiles #
+############
+
+# debug (default): no optimizations
+# release: -O2 with link-time optimization
+# size: -Os with unused functions and data removed at link time
+PROFILE ?= debug
+
+ifeq ($(PROFILE), debug)
+OPT_FLAGS    := -O0
+LD_OPT_FLAGS :=
+else ifeq ($(PROFILE), release)
+OPT_FLAGS    := -O2 -flto -ffat-lto-objects -ffunction-sections -fdata-sections
+LD_OPT_FLAGS := -O2 -flto -Wl,--gc-sections
+else ifeq ($(PROFILE), size)
+OPT_FLAGS    := -Os -ffunction-sections -fdata-sections
+LD_OPT_FLAGS := -Wl,--gc-sections
+else
+$(error Unsupported PROFILE value: $(PROFILE))
+endif
 
 #########
 # Flags #
@@ -29,6 +89,10 @@ $(error Unsupported XLEN value: $(XLEN))
 endif
 
 DFLAG ?= -g
-CFLAGS ?= -march=rv${XLEN}imac_zicsr_zifencei -mabi=${ABI} -O0 $(DFLAG) -c
-LDFLAGS ?= $(LIB_OBJ_LIST) -nostdlib -T$(LD_SCRIPT)
-
+CFLAGS ?= -march=$(MARCH) -mtune=$(MTUNE) -mabi=${ABI} $(OPT_FLAGS) $(DFLAG) -c
+# C++ sources (header-only HAL, uninasoc.hpp): no runtime support is linked
+CXXFLAGS ?= $(CFLAGS) -std=c++17 -fno-exceptions -fno-rtti -fno-threadsafe-statics -fno-use-cxa-atexit
+# Linking goes through the compiler driver, as LTO requires
+# The vector table references the handlers weakly, which does not pull them out of libuninasoc.a:
+# -u forces the default _ext_handler (PLIC dispatch) in, unless the application defines its own
+LDFLAGS ?= $(LIB_OBJ_LIST) -march=$(MARCH) -mabi=${ABI} $(LD_OPT_FLAGS) -nostdlib -Wl,-u,_ext_handler -Wl,--print-memory-usage -T$(LD_SCRIPT)
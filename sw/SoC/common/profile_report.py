@@ -0,0 +1,102 @@
+#!/bin/python3
+# Description:
+#   Compare the firmware built with different profiles (make profiles in sw/SoC).
+#   It prints the code size (text + data) of each ELF under every profile and, if UART logs
+#   are available, the average cycles of the perf_report() regions (libuninasoc perf.h).
+# Args:
+#   1: Directory with one subdirectory per profile, holding <example>.elf and optionally <example>.log
+#   2+: Profiles, the first one being the reference (e.g. debug release size)
+# Env:
+#   SIZE: size executable (default: riscv${XLEN}-unknown-elf-size, XLEN defaults to 32)
+
+####################
+# Import libraries #
+####################
+# Parse args
+import sys
+import os
+# Run size
+import subprocess
+# Parse perf_report() lines
+import re
+
+##############
+# Parameters #
+##############
+
+# "    <region>: <count>, <total>/<avg>/<max>, <instret>, <CPI>"
+PERF_LINE_RE = re.compile(r"^\s*(\S+): (\d+), (\d+)/(\d+)/(\d+), (\d+), ")
+
+#############
+# Functions #
+#############
+
+# text + data bytes of an ELF (what ends up in the binary)
+def read_size ( elf_file : str, size : str ) -> int:
+	output = subprocess.run([size, elf_file], capture_output=True, text=True, check=True).stdout
+	# text data bss dec hex filename
+	fields = output.splitlines()[1].split()
+	return int(fields[0]) + int(fields[1])
+
+# Average cycles of each perf_report() region in a UART log
+def read_cycles ( log_file : str ) -> dict:
+	cycles = {}
+	with open(log_file, errors="replace") as f:
+		for line in f:
+			match = PERF_LINE_RE.match(line)
+			if match:
+				cycles[match.group(1)] = int(match.group(4))
+	return cycles
+
+# Value and ratio to the reference column
+def format_cell ( value : int, reference : int ) -> str:
+	if value is None:
+		return "-"
+	if reference is None or reference == 0:
+		return str(value)
+	return "%d (%.2fx)" % (value, value / reference)
+
+def print_table ( title : str, rows : dict, profiles : list ):
+	print(title)
+	header = ["name"] + profiles
+	lines = [header]
+	for name in sorted(rows):
+		reference = rows[name].get(profiles[0])
+		lines.append([name] + [format_cell(rows[name].get(profile), reference) for profile in profiles])
+	widths = [max(len(line[i]) for line in lines) for i in range(len(header))]
+	for line in lines:
+		print("  ".join(cell.ljust(width) for cell, width in zip(line, widths)))
+	print()
+
+##########
+# Script #
+##########
+
+if len(sys.argv) < 3:
+	print("Usage: " + os.path.basename(sys.argv[0]) + " <build_profiles_dir> <profile> [profile ...]", file=sys.stderr)
+	sys.exit(1)
+
+build_dir = sys.argv[1]
+profiles = sys.argv[2:]
+size = os.environ.get("SIZE", "riscv" + os.environ.get("XLEN", "32") + "-unknown-elf-size")
+
+sizes = {}
+cycles = {}
+for profile in profiles:
+	profile_dir = os.path.join(build_dir, profile)
+	if not os.path.isdir(profile_dir):
+		continue
+	for file_name in sorted(os.listdir(profile_dir)):
+		name, extension = os.path.splitext(file_name)
+		path = os.path.join(profile_dir, file_name)
+		if extension == ".elf":
+			sizes.setdefault(name, {})[profile] = read_size(path, size)
+		elif extension == ".log":
+			for region, value in read_cycles(path).items():
+				cycles.setdefault(name + "/" + region, {})[profile] = value
+
+print_table("[PROFILES] Code size (text + data bytes)", sizes, profiles)
+if len(cycles) > 0:
+	print_table("[PROFILES] Average cycles per region (perf_report)", cycles, profiles)
+else:
+	print("[PROFILES] No UART logs with perf_report() output, save them as " + os.path.join(build_dir, "<profile>", "<example>.log"))
@@ -106,6 +106,22 @@ _reset_handler:
   mv t5, zero
   mv t6, zero
 
+  ###############
+  # BSS Zeroing #
+  ###############
+
+  # Zero-initialized data is not part of the binary and BRAM keeps its content
+  # across resets: clear it before any interrupt can be taken,
+  # [_bss_start, _bss_end), both 8-byte aligned
+  la t0, _bss_start
+  la t1, _bss_end
+_bss_clear:
+  bgeu t0, t1, _bss_done
+  sw zero, 0(t0)
+  addi t0, t0, 4
+  j _bss_clear
+_bss_done:
+
   #####################
   # Enable Interrupts #
   #####################
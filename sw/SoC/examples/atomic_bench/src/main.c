@@ -0,0 +1,261 @@
+// Description:
+//      LR/SC and atomic counter benchmark, to choose where to place lock words.
+//      On every memory block exported by the generated linker script (BRAM, DDR4CH0, DDR4CH1,
+//      HBM), a word is used for:
+//          - lrsc:       round trip of an uncontended lr.w/sc.w pair, with the failed SCs
+//          - plain:      non-atomic increment (load/add/store), the lower bound
+//          - irqmask:    increment with interrupts masked, the atomic.h fallback without A
+//          - fetch_add:  atomic_fetch_add32() throughput
+//          - contention: LR/SC increments while the TIM0 handler increments the same word every
+//                        <period> timer cycles, with the SC retries. The final value is checked
+//      Blocks where SC never succeeds (no exclusive access support, e.g. BRAM on HPC) are
+//      reported and skipped. Whether a DDR block is cached depends on the bitstream
+//      (ENABLE_CACHE): run it on both to compare the cached and uncached paths.
+//
+//      The lrsc and contention tests need the A extension: on cores without it (CORE_ISA in
+//      config.mk), they are skipped and every block is measured.
+//
+//      Results are printed on UART as CSV lines, other lines start with '#':
+//          atomic,<block>,<test>,<period>,<ops>,<cycles>,<retries>,<irqs>
+//      The SC success rate is ops / (ops + retries).
+//
+//      Note: TIM0 is expected to be connected to the PLIC.
+//
+
+#include "uninasoc.h"
+#include <stdint.h>
+
+#define NUM_OPS         4096
+#define PROBE_ATTEMPTS  64
+#define BRAM_WORDS      16
+
+// TIM0 periods (timer clock cycles) of the contention test, 0 for no interrupts
+static const uint32_t periods[] = { 0, 4000, 1000, 400 };
+
+// Memory blocks, missing ones resolve to 0 (weak)
+#define MEM_BLOCK_DECLARE(block)                                                    \
+    extern const volatile uint8_t _##block##_start __attribute__((weak));           \
+    extern const volatile uint8_t _##block##_end __attribute__((weak))
+
+#define MEM_BLOCK(block) { #block, (uintptr_t)&_##block##_start, (uintptr_t)&_##block##_end }
+
+MEM_BLOCK_DECLARE(BRAM);
+MEM_BLOCK_DECLARE(DDR4CH0);
+MEM_BLOCK_DECLARE(DDR4CH1);
+MEM_BLOCK_DECLARE(HBM);
+
+typedef struct {
+    const char* name;
+    uintptr_t start;
+    uintptr_t end;
+} mem_block_t;
+
+// BRAM word (.bss), on its own cache line
+static volatile uint32_t bram_words[BRAM_WORDS] __attribute__((aligned(64)));
+
+// Word under test, shared with the handler
+static volatile uint32_t* target;
+static volatile uint32_t irqs;
+
+static xlnx_tim_t timer = {
+    .base_addr = TIM0_BASEADDR,
+    .reload_mode = TIM_RELOAD_AUTO,
+    .count_direction = TIM_COUNT_DOWN
+};
+
+#ifdef __riscv_atomic
+// One LR/SC pair storing the loaded value back, returns 0 if the SC succeeded
+static inline uintptr_t lrsc_try(volatile uint32_t* addr)
+{
+    uintptr_t value;
+    asm volatile(
+        "lr.w.aqrl %0, (%1)\n"
+        "sc.w.rl %0, %0, (%1)\n"
+        : "=&r"(value)
+        : "r"(addr)
+        : "memory");
+    return value;
+}
+
+// LR/SC increment, counting the failed SCs in *retries
+static inline void lrsc_increment(volatile uint32_t* addr, uint32_t* retries)
+{
+    uint32_t old;
+    uintptr_t tmp;
+    uint32_t count = *retries;
+    asm volatile(
+        "1: lr.w.aqrl %0, (%3)\n"
+        "   addi %1, %0, 1\n"
+        "   sc.w.rl %1, %1, (%3)\n"
+        "   beqz %1, 2f\n"
+        "   addi %2, %2, 1\n"
+        "   j 1b\n"
+        "2:\n"
+        : "=&r"(old), "=&r"(tmp), "+r"(count)
+        : "r"(addr)
+        : "memory");
+    *retries = count;
+}
+#endif // __riscv_atomic
+
+static void contention_handler(void* arg)
+{
+    xlnx_tim_clear_int(&timer);
+    atomic_fetch_add32(target, 1);
+    irqs++;
+}
+
+static void print_result(const char* block, const char* test, uint32_t period, uint32_t cycles, uint32_t retries)
+{
+    printf("atomic,%s,%s,%u,%u,%u,%u,%u\n\r", block, test, period, NUM_OPS, cycles, retries, irqs);
+}
+
+static void run_block(mem_block_t* block)
+{
+    volatile uint32_t* word;
+    uintptr_t base;
+    uint32_t begin;
+    uint32_t cycles;
+    uintptr_t mstatus;
+
+    if (block->start == block->end) {
+        return;
+    }
+
+    if (block->start == (uintptr_t)&_BRAM_start) {
+        // The program lives here
+        word = bram_words;
+    } else if (HEAP_BASEADDR >= block->start && HEAP_BASEADDR < block->end) {
+        // Skip the cold sections
+        base = (HEAP_BASEADDR + ARENA_ALIGN_LINE - 1) & ~(uintptr_t)(ARENA_ALIGN_LINE - 1);
+        if (base >= block->end) {
+            return;
+        }
+        word = (volatile uint32_t*)base;
+    } else {
+        word = (volatile uint32_t*)block->start;
+    }
+
+    printf("# %s: word at 0x%08x\n\r", block->name, (uintptr_t)word);
+
+#ifdef __riscv_atomic
+    uint32_t failures = 0;
+    uint32_t retries;
+
+    // The other tests spin until SC succeeds
+    *word = 0;
+    for (uint32_t i = 0; i < PROBE_ATTEMPTS; i++) {
+        failures += lrsc_try(word) != 0;
+    }
+    if (failures == PROBE_ATTEMPTS) {
+        printf("# %s: SC never succeeds, no exclusive access support, skipped\n\r", block->name);
+        return;
+    }
+
+    target = word;
+    irqs = 0;
+
+    // Uncontended round trip
+    failures = 0;
+    begin = perf_cycles32();
+    for (uint32_t i = 0; i < NUM_OPS; i++) {
+        failures += lrsc_try(word) != 0;
+    }
+    cycles = perf_cycles32() - begin;
+    print_result(block->name, "lrsc", 0, cycles, failures);
+#endif // __riscv_atomic
+
+    begin = perf_cycles32();
+    for (uint32_t i = 0; i < NUM_OPS; i++) {
+        (*word)++;
+    }
+    cycles = perf_cycles32() - begin;
+    print_result(block->name, "plain", 0, cycles, 0);
+
+    begin = perf_cycles32();
+    for (uint32_t i = 0; i < NUM_OPS; i++) {
+        asm volatile("csrrc %0, mstatus, 0x8" : "=r"(mstatus) :: "memory");
+        (*word)++;
+        if (mstatus & 0x8) {
+            asm volatile("csrs mstatus, 0x8" ::: "memory");
+        }
+    }
+    cycles = perf_cycles32() - begin;
+    print_result(block->name, "irqmask", 0, cycles, 0);
+
+    begin = perf_cycles32();
+    for (uint32_t i = 0; i < NUM_OPS; i++) {
+        atomic_fetch_add32(word, 1);
+    }
+    cycles = perf_cycles32() - begin;
+    print_result(block->name, "fetch_add", 0, cycles, 0);
+
+#ifdef __riscv_atomic
+    // Interrupt-induced contention
+    for (uint32_t p = 0; p < sizeof(periods) / sizeof(periods[0]); p++) {
+        *word = 0;
+        irqs = 0;
+        retries = 0;
+
+        if (periods[p] != 0) {
+            timer.counter = periods[p];
+            xlnx_tim_configure(&timer);
+            xlnx_tim_enable_int(&timer);
+            xlnx_tim_start(&timer);
+        }
+
+        begin = perf_cycles32();
+        for (uint32_t i = 0; i < NUM_OPS; i++) {
+            lrsc_increment(word, &retries);
+        }
+        cycles = perf_cycles32() - begin;
+
+        if (periods[p] != 0) {
+            xlnx_tim_stop(&timer);
+            xlnx_tim_clear_int(&timer);
+        }
+
+        print_result(block->name, "contention", periods[p], cycles, retries);
+
+        // Every increment must be there, from both sides
+        if (*word != NUM_OPS + irqs) {
+            printf("# [ERROR] %s: lost updates, %u instead of %u\n\r", block->name, *word, NUM_OPS + irqs);
+        }
+    }
+#endif // __riscv_atomic
+}
+
+int main()
+{
+    mem_block_t blocks[] = {
+        MEM_BLOCK(BRAM),
+        MEM_BLOCK(DDR4CH0),
+        MEM_BLOCK(DDR4CH1),
+        MEM_BLOCK(HBM),
+    };
+
+    // Initialize HAL
+    uninasoc_init();
+    perf_init();
+
+    plic_init();
+    plic_register_handler(PLIC_TIM0_INTERRUPT, contention_handler, NULL, 1);
+
+    printf("\n\r");
+    printf("# -------------------------------\n\r");
+    printf("# - LR/SC and atomics benchmark -\n\r");
+    printf("# -------------------------------\n\r");
+    printf("# XLEN = %u\n\r", (uint32_t)(sizeof(uintptr_t) * 8));
+    printf("# atomic,block,test,period,ops,cycles,retries,irqs\n\r");
+#ifndef __riscv_atomic
+    printf("# No A extension: lrsc and contention tests skipped\n\r");
+#endif
+
+    for (uint32_t i = 0; i < sizeof(blocks) / sizeof(blocks[0]); i++) {
+        run_block(&blocks[i]);
+    }
+
+    printf("# done\n\r");
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+// Description:
+//      64-bit clocksource example (clock.h).
+//          - Cost of a clock read, in core cycles, and monotonicity over NUM_READS reads
+//          - clock_delay_us() for a few delays, measured with both the clocksource (ns) and
+//            the core cycle counter
+//
+//      Note: TIM1 is used as clocksource, do not combine it with the profiler (prof.h).
+//
+
+#include "uninasoc.h"
+#include <stdint.h>
+
+#define NUM_READS   1000
+
+static const uint32_t delays_us[] = { 1, 10, 100, 1000 };
+
+int main()
+{
+    uint64_t prev;
+    uint64_t now;
+    uint64_t start_ns;
+    uint32_t errors = 0;
+    uint32_t begin;
+    uint32_t cycles;
+
+    // Initialize HAL
+    uninasoc_init();
+    perf_init();
+
+    printf("Clocksource Test\r\n");
+    printf("Timer clock: %u MHz\r\n", CLOCK_FREQ_MHZ);
+
+    if (clock_init() != UNINASOC_OK) {
+        printf("[ERROR] clock_init() failed\r\n");
+        return 1;
+    }
+
+    // Read cost and monotonicity
+    prev = clock_ticks();
+    begin = perf_cycles32();
+    for (uint32_t i = 0; i < NUM_READS; i++) {
+        now = clock_ticks();
+        if (now < prev) {
+            errors++;
+        }
+        prev = now;
+    }
+    cycles = perf_cycles32() - begin;
+    printf("[read] %u reads in %u cycles: %u cycles/read, %u going backwards\r\n", NUM_READS, cycles, cycles / NUM_READS, errors);
+
+    // Delays
+    for (uint32_t i = 0; i < sizeof(delays_us) / sizeof(delays_us[0]); i++) {
+        start_ns = clock_now_ns();
+        begin = perf_cycles32();
+        clock_delay_us(delays_us[i]);
+        cycles = perf_cycles32() - begin;
+        printf("[delay] %u us: %u ns, %u cycles\r\n", delays_us[i], (uint32_t)(clock_now_ns() - start_ns), cycles);
+    }
+
+    printf("[uptime] %u us\r\n", (uint32_t)clock_now_us());
+
+    return 0;
+}
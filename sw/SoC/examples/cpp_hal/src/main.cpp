@@ -0,0 +1,60 @@
+// Description:
+//  C++ HAL (uninasoc.hpp) example: UART output, timer readout and GPIO switches to leds,
+//  without libuninasoc calls. Every register access compiles to a load or a store with an
+//  immediate offset from the generated base address.
+
+#include "uninasoc.hpp"
+
+using namespace uninasoc;
+
+#ifdef UART_IS_ENABLED
+static void print_hex(uint32_t value)
+{
+    static constexpr char digits[] = "0123456789abcdef";
+    uart::puts("0x");
+    for (int shift = 28; shift >= 0; shift -= 4) {
+        uart::putc(digits[(value >> shift) & 0xf]);
+    }
+    uart::puts("\r\n");
+}
+#endif
+
+int main()
+{
+#ifdef UART_IS_ENABLED
+    uart::init();
+    uart::puts("Hello from the C++ HAL!\r\n");
+#endif
+
+#ifdef TIM_IS_ENABLED
+    // Free-running counter
+    tim0::configure(0, false, true);
+    tim0::start();
+    uint32_t start = tim0::value();
+    uint32_t end = tim0::value();
+    tim0::stop();
+#ifdef UART_IS_ENABLED
+    uart::puts("Timer ticks between two reads: ");
+    print_hex(end - start);
+#endif
+#endif
+
+#if defined(GPIO_IN_IS_ENABLED) && defined(GPIO_OUT_IS_ENABLED)
+    // Mirror the switches on the leds, until a character is received
+    for (;;) {
+        gpio_out::write(gpio_in::read());
+#ifdef UART_IS_ENABLED
+        char c;
+        if (uart::try_getc(c)) {
+            break;
+        }
+#endif
+    }
+#endif
+
+#ifdef UART_IS_ENABLED
+    uart::flush();
+#endif
+
+    return 0;
+}
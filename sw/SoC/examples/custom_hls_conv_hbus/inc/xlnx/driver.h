@@ -6,7 +6,7 @@
 #include "xkrnl_conv_hbus_hw.h"
 
 // Import symbols for peripherals
-extern const volatile uintptr_t _peripheral_HLS_CONTROL_start;
+extern const volatile uint32_t _peripheral_HLS_CONTROL_start;
 
 // Offsets
 #define Xkrnl_BASE             ((uintptr_t)(&_peripheral_HLS_CONTROL_start))
@@ -17,6 +17,9 @@ extern const volatile uintptr_t _peripheral_HLS_CONTROL_start;
 #define Xkrnl_AXI_ADDR_I       (Xkrnl_BASE + XKRNL_CONV_HBUS_CONTROL_ADDR_I_DATA)
 #define Xkrnl_AXI_ADDR_W       (Xkrnl_BASE + XKRNL_CONV_HBUS_CONTROL_ADDR_W_DATA)
 #define Xkrnl_AXI_ADDR_O       (Xkrnl_BASE + XKRNL_CONV_HBUS_CONTROL_ADDR_O_DATA)
+#define Xkrnl_AXI_ADDR_I_HI    (Xkrnl_AXI_ADDR_I + 4)
+#define Xkrnl_AXI_ADDR_W_HI    (Xkrnl_AXI_ADDR_W + 4)
+#define Xkrnl_AXI_ADDR_O_HI    (Xkrnl_AXI_ADDR_O + 4)
 #define Xkrnl_N                (Xkrnl_BASE + XKRNL_CONV_HBUS_CONTROL_ADDR_N_INPUT_DATA)
 #define Xkrnl_C                (Xkrnl_BASE + XKRNL_CONV_HBUS_CONTROL_ADDR_C_INPUT_DATA)
 #define Xkrnl_K                (Xkrnl_BASE + XKRNL_CONV_HBUS_CONTROL_ADDR_K_INPUT_DATA)
@@ -39,19 +42,19 @@ extern const volatile uintptr_t _peripheral_HLS_CONTROL_start;
 
 // Control
 #define XKrnl_EnableAutoRestart() \
-    Xil_Out32(Xkrnl_Control, AP_AUTORESTART_BIT)
+    Xil_Out32(Xkrnl_Control, AP_AUTORESTART)
 
 #define XKrnl_Start() \
     Xil_Out32(Xkrnl_Control, (Xil_In32(Xkrnl_Control) & AP_AUTORESTART) | AP_START)
 
 #define XKrnl_IsDone() \
-    (Xil_In32(Xkrnl_Control) & AP_DONE_BIT)
+    (Xil_In32(Xkrnl_Control) & AP_DONE)
 
 #define XKrnl_IsIdle() \
-    (Xil_In32(Xkrnl_Control) & AP_IDLE_BIT)
+    (Xil_In32(Xkrnl_Control) & AP_IDLE)
 
 #define XKrnl_IsReady() \
-    (Xil_In32(Xkrnl_Control) & AP_READY_BIT)
+    (Xil_In32(Xkrnl_Control) & AP_READY)
 
 // GIE
 #define XKrnl_InterruptGlobalEnable() \
@@ -60,12 +63,12 @@ extern const volatile uintptr_t _peripheral_HLS_CONTROL_start;
 #define XKrnl_InterruptGlobalDisable() \
     Xil_Out32(Xkrnl_GIE, 0x0)
 
-// ISR
+// ISR (Toggle On Write)
 #define XKrnl_InterruptClear_ap_done() \
-    Xil_Out32(Xkrnl_ISR, 0x0)
+    Xil_Out32(Xkrnl_ISR, 0x1)
 
 #define XKrnl_InterruptClear_ap_ready() \
-    Xil_Out32(Xkrnl_ISR, 0x1)
+    Xil_Out32(Xkrnl_ISR, 0x2)
 
 #define XKrnl_InterruptGetStatus() \
     Xil_In32(Xkrnl_ISR)
@@ -0,0 +1,122 @@
+// Description:
+//      Cost of the libuninasoc allocators (arena.h, heap.h) over the heap region exported by the
+//      linker script (_heap_start/_heap_end, e.g. DDR).
+//      It reports the worst and average core cycles per call of malloc(), free() and of a pool
+//      carved from the heap, under a pseudo-random alloc/free pattern of mixed sizes.
+//
+//      Note: the heap is empty on SoCs with the boot memory only (e.g. embedded).
+//
+
+#include "uninasoc.h"
+#include <stdint.h>
+
+#define NUM_SLOTS       64
+#define NUM_ITERATIONS  2000
+#define MAX_SIZE        512
+#define POOL_BLOCKS     32
+
+typedef struct {
+    uint32_t calls;
+    uint32_t total;
+    uint32_t max;
+} cost_t;
+
+static void cost_add(cost_t* cost, uint32_t cycles)
+{
+    cost->calls++;
+    cost->total += cycles;
+    if (cycles > cost->max)
+        cost->max = cycles;
+}
+
+static void cost_print(const char* name, cost_t* cost)
+{
+    printf("    %s: %u calls, avg %u, max %u cycles\n\r", name, cost->calls, cost->calls ? cost->total / cost->calls : 0, cost->max);
+}
+
+// xorshift32
+static uint32_t seed = 0x1234567;
+static uint32_t next_random()
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+int main()
+{
+    void* slots[NUM_SLOTS] = {0};
+    cost_t alloc_cost = {0};
+    cost_t free_cost = {0};
+    cost_t pool_alloc_cost = {0};
+    cost_t pool_free_cost = {0};
+    uint32_t failures = 0;
+    uint32_t begin;
+    arena_t arena;
+    pool_t pool;
+    void* arena_memory;
+
+    // Initialize HAL
+    uninasoc_init();
+    perf_init();
+
+    printf("Heap Benchmark: heap at 0x%08lx, %u bytes\n\r", (unsigned long)HEAP_BASEADDR, (uint32_t)(HEAP_ENDADDR - HEAP_BASEADDR));
+
+    // General allocator
+    for (uint32_t i = 0; i < NUM_ITERATIONS; i++) {
+        uint32_t slot = next_random() % NUM_SLOTS;
+        if (slots[slot] == NULL) {
+            uint32_t size = (next_random() % MAX_SIZE) + 1;
+            begin = perf_cycles32();
+            slots[slot] = malloc(size);
+            cost_add(&alloc_cost, perf_cycles32() - begin);
+            if (slots[slot] == NULL)
+                failures++;
+        } else {
+            begin = perf_cycles32();
+            free(slots[slot]);
+            cost_add(&free_cost, perf_cycles32() - begin);
+            slots[slot] = NULL;
+        }
+    }
+
+    printf("malloc/free (%u failures, peak %u bytes):\n\r", failures, (uint32_t)heap_get_peak(&uninasoc_heap));
+    cost_print("malloc", &alloc_cost);
+    cost_print("free", &free_cost);
+
+    for (uint32_t i = 0; i < NUM_SLOTS; i++) {
+        free(slots[i]);
+        slots[i] = NULL;
+    }
+
+    // Pool for hot fixed-size objects, carved from an arena allocated on the heap
+    arena_memory = malloc(POOL_BLOCKS * 64 + ARENA_ALIGN_LINE);
+    if (arena_memory == NULL || arena_init(&arena, (uintptr_t)arena_memory, POOL_BLOCKS * 64 + ARENA_ALIGN_LINE) != UNINASOC_OK
+        || pool_init(&pool, &arena, 64, POOL_BLOCKS, ARENA_ALIGN_LINE) != UNINASOC_OK) {
+        printf("[ERROR] Cannot create the pool\n\r");
+        return 1;
+    }
+
+    for (uint32_t i = 0; i < NUM_ITERATIONS; i++) {
+        uint32_t slot = next_random() % POOL_BLOCKS;
+        if (slots[slot] == NULL) {
+            begin = perf_cycles32();
+            slots[slot] = pool_alloc(&pool);
+            cost_add(&pool_alloc_cost, perf_cycles32() - begin);
+        } else {
+            begin = perf_cycles32();
+            pool_free(&pool, slots[slot]);
+            cost_add(&pool_free_cost, perf_cycles32() - begin);
+            slots[slot] = NULL;
+        }
+    }
+
+    printf("pool (64 B blocks):\n\r");
+    cost_print("pool_alloc", &pool_alloc_cost);
+    cost_print("pool_free", &pool_free_cost);
+
+    free(arena_memory);
+
+    return 0;
+}
@@ -17,8 +17,6 @@
 #include "uninasoc.h"
 #include <stdint.h>
 
-#define SOURCES_NUM 3 // regardless of embedded/hpc
-
 #ifdef IS_EMBEDDED
 xlnx_gpio_in_t gpio_in = {
     .base_addr = GPIO_IN_BASEADDR,
@@ -37,66 +35,31 @@ xlnx_tim_t timer = {
     .count_direction = TIM_COUNT_DOWN
 };
 
-// IMPORTANT:
-// when defining custom handlers always use the "__irq_handler__" symbol
-// this symbol is crucial, omitting it would make the compiler treat them like normal functions
-// creating wrong epilogue and prologue
-
-void _sw_handler() __irq_handler__;
-void _timer_handler() __irq_handler__;
-void _ext_handler() __irq_handler__;
+// PLIC source handlers, dispatched by the default _ext_handler (plic_dispatch()).
+// They run inside the interrupt context, with interrupts disabled.
 
-void _sw_handler(void)
-{
-    // Unused for this example
-}
-
-void _timer_handler(void)
+#ifdef IS_EMBEDDED
+void gpio_in_handler(void* arg)
 {
-    // Unused for this example
+    printf("Handiling GPIO_IN interrupt!\r\n");
+    #ifdef GPIO_OUT_IS_ENABLED
+    xlnx_gpio_out_toggle(&gpio_out, PIN_0);
+    #endif // GPIO_OUT_IS_ENABLED
+    #ifdef GPIO_IN_IS_ENABLED
+    xlnx_gpio_in_clear_int(&gpio_in);
+    #endif // GPIO_IN_IS_ENABLED
 }
+#endif // IS_EMBEDDED
 
-void _ext_handler(void)
+void tim0_handler(void* arg)
 {
-    // Interrupts are automatically disabled by the microarchitecture.
-    // Nested interrupts can be enabled manually by setting the IE bit in the mstatus register,
-    // but this requires careful handling of registers.
-    // Interrupts are automatically re-enabled by the microarchitecture when the MRET instruction is executed.
-
-    // In this example, the core is connected to PLIC target 1 line.
-    // Therefore, we need to access the PLIC claim/complete register 1 (base_addr + 0x200004).
-    // The interrupt source ID is obtained from the claim register.
-
-    uint32_t interrupt_id = plic_claim();
-    switch (interrupt_id) {
-    case 0x0: // unused
-        break;
-    case 0x1:
-        printf("Handiling GPIO_IN interrupt!\r\n");
-        #ifdef GPIO_OUT_IS_ENABLED
-        xlnx_gpio_out_toggle(&gpio_out, PIN_0);
-        #endif // GPIO_OUT_IS_ENABLED
-        #ifdef GPIO_IN_IS_ENABLED
-        xlnx_gpio_in_clear_int(&gpio_in);
-        #endif // GPIO_IN_IS_ENABLED
-        break;
-    case 0x2:
-        // Timer interrupt
-        printf("Handiling TIM0 interrupt!\r\n");
-        #ifdef GPIO_OUT_IS_ENABLED
-        xlnx_gpio_out_toggle(&gpio_out, PIN_1);
-        #endif // GPIO_OUT_IS_ENABLED
-        xlnx_tim_clear_int(&timer);
-        break;
-    default:
-        break;
-    }
-
-    // To notify the handler completion, a write-back on the claim/complete register is required.
-    plic_complete(interrupt_id);
+    printf("Handiling TIM0 interrupt!\r\n");
+    #ifdef GPIO_OUT_IS_ENABLED
+    xlnx_gpio_out_toggle(&gpio_out, PIN_1);
+    #endif // GPIO_OUT_IS_ENABLED
+    xlnx_tim_clear_int((xlnx_tim_t*)arg);
 }
 
-
 // Main function
 int main()
 {
@@ -105,11 +68,12 @@ int main()
 
     printf("Interrupts Example\r\n");
 
-    // Configure the PLIC
-    uint32_t priorities[SOURCES_NUM] = { 1, 1, 1 };
+    // Configure the PLIC: register and enable one handler per source
     plic_init();
-    plic_configure(priorities, SOURCES_NUM);
-    plic_enable_all();
+    #ifdef IS_EMBEDDED
+    plic_register_handler(PLIC_GPIOIN_INTERRUPT, gpio_in_handler, NULL, 1);
+    #endif // IS_EMBEDDED
+    plic_register_handler(PLIC_TIM0_INTERRUPT, tim0_handler, &timer, 1);
 
     #ifdef GPIO_IN_IS_ENABLED
     if (xlnx_gpio_in_init(&gpio_in) != UNINASOC_OK)
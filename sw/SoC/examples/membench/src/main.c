@@ -0,0 +1,355 @@
+// Description:
+//      Bare-metal benchmark of the memory system as seen by the core, on every memory block
+//      exported by the generated linker script (BRAM, DDR4CH0, DDR4CH1, HBM):
+//          - stream: copy, scale, add and triad kernels on XLEN-wide integers (STREAM-style),
+//            best of STREAM_REPS runs
+//          - chase:  dependent loads along a random cycle of cache lines (latency), for
+//            footprints from 1KB up to the tested window
+//          - stride: independent loads every <stride> bytes over the whole window
+//      On BRAM the window is a static buffer, since the block also holds the program.
+//      On the cold memory block it starts after the cold sections (see section.h).
+//      The kernels are placed in BRAM (__hot), so that only the data accesses hit the memory
+//      under test. Run it on bitstreams with and without the system cache (ENABLE_CACHE) to
+//      compare DDR with and without it.
+//
+//      Results are printed on UART as CSV lines, other lines start with '#':
+//          membench,<block>,stream,<kernel>,<bytes moved>,<cycles>
+//          membench,<block>,chase,<footprint bytes>,<loads>,<cycles>
+//          membench,<block>,stride,<stride bytes>,<loads>,<cycles>
+//      e.g. grep ^membench uart.log
+//
+//      On bitstreams with the system cache statistics (CACHE_CTRL), each test is followed by
+//      the system cache counters accumulated during it, setup and warm-up included:
+//          syscache,<block>,<test>,<read hits>,<read misses>,<write hits>,<write misses>,<evictions>
+//
+//      Note: cycles include the loop overhead (a few instructions per access).
+//
+
+#include "uninasoc.h"
+#include <stdint.h>
+
+#define STREAM_REPS         4
+#define STREAM_SCALAR       3
+#define CHASE_LOADS         8192
+#define CHASE_MIN_FOOTPRINT 1024
+#define CHASE_NODE_SIZE     ARENA_ALIGN_LINE    // One node per cache line
+#define STRIDE_LOADS        4096
+#define STRIDE_MIN_PASS     16                  // Loads per pass over the window, at least
+
+// Upper bound of the tested window, to bound the run time on large blocks (e.g. 1GB DDR)
+#define MAX_WINDOW_SIZE     (256 * 1024)
+#define BRAM_WINDOW_SIZE    (16 * 1024)
+
+// Memory blocks, missing ones resolve to 0 (weak)
+#define MEM_BLOCK_DECLARE(block)                                                    \
+    extern const volatile uint8_t _##block##_start __attribute__((weak));           \
+    extern const volatile uint8_t _##block##_end __attribute__((weak))
+
+#define MEM_BLOCK(block) { #block, (uintptr_t)&_##block##_start, (uintptr_t)&_##block##_end }
+
+MEM_BLOCK_DECLARE(BRAM);
+MEM_BLOCK_DECLARE(DDR4CH0);
+MEM_BLOCK_DECLARE(DDR4CH1);
+MEM_BLOCK_DECLARE(HBM);
+
+typedef struct {
+    const char* name;
+    uintptr_t start;
+    uintptr_t end;
+} mem_block_t;
+
+// BRAM window (.bss)
+static uint8_t bram_window[BRAM_WINDOW_SIZE] __attribute__((aligned(64)));
+
+// Keeps the loaded values alive
+static volatile uintptr_t sink;
+
+/////////////
+// Kernels //
+/////////////
+
+#define KERNEL __hot __attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+
+KERNEL static void stream_copy(uintptr_t* c, const uintptr_t* a, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        c[i] = a[i];
+    }
+}
+
+KERNEL static void stream_scale(uintptr_t* b, const uintptr_t* c, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        b[i] = STREAM_SCALAR * c[i];
+    }
+}
+
+KERNEL static void stream_add(uintptr_t* c, const uintptr_t* a, const uintptr_t* b, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        c[i] = a[i] + b[i];
+    }
+}
+
+KERNEL static void stream_triad(uintptr_t* a, const uintptr_t* b, const uintptr_t* c, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        a[i] = b[i] + STREAM_SCALAR * c[i];
+    }
+}
+
+KERNEL static void* chase(void* node, uint32_t loads)
+{
+    void** p = (void**)node;
+
+    // Each load depends on the previous one
+    for (uint32_t i = 0; i < loads; i += 4) {
+        p = (void**)*p;
+        p = (void**)*p;
+        p = (void**)*p;
+        p = (void**)*p;
+    }
+    return p;
+}
+
+KERNEL static uintptr_t stride_read(uintptr_t base, size_t window, size_t stride, uint32_t loads)
+{
+    uintptr_t addr = base;
+    uintptr_t end = base + window;
+    uintptr_t sum = 0;
+
+    for (uint32_t i = 0; i < loads; i++) {
+        sum += *(volatile uintptr_t*)addr;
+        addr += stride;
+        if (addr >= end) {
+            addr = base;
+        }
+    }
+    return sum;
+}
+
+/////////////
+// Helpers //
+/////////////
+
+// xorshift32
+static uint32_t seed = 0x1234567;
+static uint32_t next_random()
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static void print_result(const char* block, const char* test, const char* param, uint32_t count, uint32_t cycles)
+{
+    printf("membench,%s,%s,%s,%u,%u\n\r", block, test, param, count, cycles);
+}
+
+// Counters since the last xlnx_syscache_stats_reset(), if the statistics are available
+static void print_cache_stats(const char* block, const char* test)
+{
+    xlnx_syscache_stats_t stats;
+
+    if (xlnx_syscache_stats_read(&stats) != UNINASOC_OK) {
+        return;
+    }
+    printf("syscache,%s,%s,%u,%u,%u,%u,%u\n\r", block, test,
+        (uint32_t)stats.read_hits, (uint32_t)stats.read_misses,
+        (uint32_t)stats.write_hits, (uint32_t)stats.write_misses,
+        (uint32_t)stats.evictions);
+}
+
+static void print_result_num(const char* block, const char* test, uint32_t param, uint32_t count, uint32_t cycles)
+{
+    printf("membench,%s,%s,%u,%u,%u\n\r", block, test, param, count, cycles);
+}
+
+///////////
+// Tests //
+///////////
+
+static void run_stream(const char* block, uintptr_t base, size_t window)
+{
+    // Three arrays, one per third of the window
+    size_t n = (window / 3) / sizeof(uintptr_t);
+    uintptr_t* a = (uintptr_t*)base;
+    uintptr_t* b = a + n;
+    uintptr_t* c = b + n;
+    uint32_t best[4] = { UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX };
+    uint32_t begin;
+    uint32_t cycles;
+
+    for (size_t i = 0; i < n; i++) {
+        a[i] = 1;
+        b[i] = 2;
+        c[i] = 0;
+    }
+
+    for (uint32_t rep = 0; rep < STREAM_REPS; rep++) {
+        begin = perf_cycles32();
+        stream_copy(c, a, n);
+        cycles = perf_cycles32() - begin;
+        best[0] = cycles < best[0] ? cycles : best[0];
+
+        begin = perf_cycles32();
+        stream_scale(b, c, n);
+        cycles = perf_cycles32() - begin;
+        best[1] = cycles < best[1] ? cycles : best[1];
+
+        begin = perf_cycles32();
+        stream_add(c, a, b, n);
+        cycles = perf_cycles32() - begin;
+        best[2] = cycles < best[2] ? cycles : best[2];
+
+        begin = perf_cycles32();
+        stream_triad(a, b, c, n);
+        cycles = perf_cycles32() - begin;
+        best[3] = cycles < best[3] ? cycles : best[3];
+    }
+
+    // Copy and scale move two words per element, add and triad three
+    print_result(block, "stream", "copy", 2 * n * sizeof(uintptr_t), best[0]);
+    print_result(block, "stream", "scale", 2 * n * sizeof(uintptr_t), best[1]);
+    print_result(block, "stream", "add", 3 * n * sizeof(uintptr_t), best[2]);
+    print_result(block, "stream", "triad", 3 * n * sizeof(uintptr_t), best[3]);
+}
+
+// Link the nodes of [base, base + footprint) in a single random cycle (Sattolo's algorithm)
+static void* chase_setup(uintptr_t base, size_t footprint)
+{
+    size_t num_nodes = footprint / CHASE_NODE_SIZE;
+    uintptr_t* node;
+    uintptr_t tmp;
+    size_t j;
+
+    // Shuffle the node indices, stored in the nodes themselves
+    for (size_t i = 0; i < num_nodes; i++) {
+        *(uintptr_t*)(base + i * CHASE_NODE_SIZE) = i;
+    }
+    for (size_t i = num_nodes - 1; i > 0; i--) {
+        j = next_random() % i;
+        node = (uintptr_t*)(base + i * CHASE_NODE_SIZE);
+        tmp = *node;
+        *node = *(uintptr_t*)(base + j * CHASE_NODE_SIZE);
+        *(uintptr_t*)(base + j * CHASE_NODE_SIZE) = tmp;
+    }
+
+    // Indices to pointers
+    for (size_t i = 0; i < num_nodes; i++) {
+        node = (uintptr_t*)(base + i * CHASE_NODE_SIZE);
+        *node = base + *node * CHASE_NODE_SIZE;
+    }
+
+    return (void*)base;
+}
+
+static void run_chase(const char* block, uintptr_t base, size_t window)
+{
+    void* node;
+    uint32_t begin;
+    uint32_t cycles;
+
+    for (size_t footprint = CHASE_MIN_FOOTPRINT; footprint <= window; footprint *= 2) {
+        node = chase_setup(base, footprint);
+
+        // Warm up with one lap, then measure
+        node = chase(node, (footprint / CHASE_NODE_SIZE + 3) & ~3);
+        begin = perf_cycles32();
+        node = chase(node, CHASE_LOADS);
+        cycles = perf_cycles32() - begin;
+        sink = (uintptr_t)node;
+
+        print_result_num(block, "chase", footprint, CHASE_LOADS, cycles);
+    }
+}
+
+static void run_stride(const char* block, uintptr_t base, size_t window)
+{
+    uint32_t begin;
+    uint32_t cycles;
+
+    for (size_t stride = sizeof(uintptr_t); stride <= window / STRIDE_MIN_PASS; stride *= 2) {
+        // Warm up with one pass, then measure
+        sink = stride_read(base, window, stride, window / stride);
+        begin = perf_cycles32();
+        sink = stride_read(base, window, stride, STRIDE_LOADS);
+        cycles = perf_cycles32() - begin;
+
+        print_result_num(block, "stride", stride, STRIDE_LOADS, cycles);
+    }
+}
+
+static void run_block(mem_block_t* block)
+{
+    uintptr_t base = block->start;
+    uintptr_t end = block->end;
+    size_t window;
+
+    if (block->start == block->end) {
+        return;
+    }
+
+    if (block->start == (uintptr_t)&_BRAM_start) {
+        // The program lives here
+        base = (uintptr_t)bram_window;
+        end = base + sizeof(bram_window);
+    } else if (HEAP_BASEADDR >= block->start && HEAP_BASEADDR < block->end) {
+        // Skip the cold sections
+        base = (HEAP_BASEADDR + ARENA_ALIGN_PAGE - 1) & ~(uintptr_t)(ARENA_ALIGN_PAGE - 1);
+    }
+
+    // Largest power of two that fits, for the chase and stride footprints
+    window = CHASE_MIN_FOOTPRINT;
+    while (window * 2 <= end - base && window * 2 <= MAX_WINDOW_SIZE) {
+        window *= 2;
+    }
+    if (base + window > end) {
+        printf("# %s: skipped, less than %u B available\n\r", block->name, CHASE_MIN_FOOTPRINT);
+        return;
+    }
+
+    printf("# %s: window 0x%08x - 0x%08x (%u B)\n\r", block->name, base, base + window, (uint32_t)window);
+
+    xlnx_syscache_stats_reset();
+    run_stream(block->name, base, window);
+    print_cache_stats(block->name, "stream");
+
+    xlnx_syscache_stats_reset();
+    run_chase(block->name, base, window);
+    print_cache_stats(block->name, "chase");
+
+    xlnx_syscache_stats_reset();
+    run_stride(block->name, base, window);
+    print_cache_stats(block->name, "stride");
+}
+
+int main()
+{
+    mem_block_t blocks[] = {
+        MEM_BLOCK(BRAM),
+        MEM_BLOCK(DDR4CH0),
+        MEM_BLOCK(DDR4CH1),
+        MEM_BLOCK(HBM),
+    };
+
+    // Initialize HAL
+    uninasoc_init();
+    perf_init();
+
+    printf("\n\r");
+    printf("# ------------------------------\n\r");
+    printf("# - Memory system benchmark    -\n\r");
+    printf("# ------------------------------\n\r");
+    printf("# XLEN = %u\n\r", (uint32_t)(sizeof(uintptr_t) * 8));
+    printf("# membench,block,test,param,count,cycles\n\r");
+
+    for (uint32_t i = 0; i < sizeof(blocks) / sizeof(blocks[0]); i++) {
+        run_block(&blocks[i]);
+    }
+
+    printf("# done\n\r");
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+// Description:
+//      Bare-metal microbenchmark for the libuninasoc mem* functions.
+//      It reports the throughput (bytes/cycle) of memcpy, memmove, memset and memcmp
+//      against a byte-wise reference loop, on BRAM and (if present) on DDR4CH1.
+//      Buffers are word-aligned, plus one misaligned memcpy run (src + 1) to measure
+//      the byte-wise fallback.
+
+#include "uninasoc.h"
+#include <stdint.h>
+
+#define BUF_SIZE    4096
+#define ITERATIONS  8
+
+// BRAM buffers (.bss)
+static uint8_t bram_src[BUF_SIZE] __attribute__((aligned(64)));
+static uint8_t bram_dst[BUF_SIZE] __attribute__((aligned(64)));
+
+// Byte-wise reference (the former libuninasoc memcpy)
+__attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+static void* bytewise_memcpy(void* dest, const void* src, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        ((char*)dest)[i] = ((char*)src)[i];
+    }
+    return dest;
+}
+
+// Print bytes/cycle with three decimals, no floating point support needed
+static void print_throughput(const char* name, size_t bytes, uint32_t cycles)
+{
+    uint32_t milli = (uint32_t)(((uint64_t)bytes * 1000) / (cycles ? cycles : 1));
+    printf("    %s: %u B in %u cycles -> %u.%03u B/cycle\n\r", name, (uint32_t)bytes, cycles, milli / 1000, milli % 1000);
+}
+
+static void run_bench(const char* mem_name, uint8_t* src, uint8_t* dst, size_t size)
+{
+    uint32_t begin;
+    uint32_t cycles;
+    size_t bytes = size * ITERATIONS;
+    volatile int cmp = 0;
+
+    printf("[%s] src = 0x%08x, dst = 0x%08x, size = %u\n\r", mem_name, (uintptr_t)src, (uintptr_t)dst, (uint32_t)size);
+
+    // Init source, warm up destination
+    for (size_t i = 0; i < size; i++) {
+        src[i] = (uint8_t)i;
+    }
+    memset(dst, 0, size);
+
+    begin = perf_cycles32();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        bytewise_memcpy(dst, src, size);
+    }
+    cycles = perf_cycles32() - begin;
+    print_throughput("bytewise copy", bytes, cycles);
+
+    begin = perf_cycles32();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        memcpy(dst, src, size);
+    }
+    cycles = perf_cycles32() - begin;
+    print_throughput("memcpy", bytes, cycles);
+
+    begin = perf_cycles32();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        memcpy(dst, src + 1, size - 1);
+    }
+    cycles = perf_cycles32() - begin;
+    print_throughput("memcpy (misal.)", (size - 1) * ITERATIONS, cycles);
+
+    // Overlapping backward move
+    begin = perf_cycles32();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        memmove(dst + sizeof(uintptr_t), dst, size - sizeof(uintptr_t));
+    }
+    cycles = perf_cycles32() - begin;
+    print_throughput("memmove", (size - sizeof(uintptr_t)) * ITERATIONS, cycles);
+
+    begin = perf_cycles32();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        memset(dst, (int)i, size);
+    }
+    cycles = perf_cycles32() - begin;
+    print_throughput("memset", bytes, cycles);
+
+    // Equal buffers, full scan
+    memcpy(dst, src, size);
+    begin = perf_cycles32();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        cmp |= memcmp(dst, src, size);
+    }
+    cycles = perf_cycles32() - begin;
+    print_throughput("memcmp", bytes, cycles);
+
+    if (cmp != 0) {
+        printf("[ERROR] memcmp mismatch on %s\n\r", mem_name);
+    }
+}
+
+int main()
+{
+    // Initialize HAL
+    uninasoc_init();
+    perf_init();
+
+    printf("\n\r");
+    printf("------------------\n\r");
+    printf("- mem* benchmark -\n\r");
+    printf("------------------\n\r");
+    printf("XLEN = %u, %u iterations\n\r", (uint32_t)(sizeof(uintptr_t) * 8), ITERATIONS);
+
+    run_bench("BRAM", bram_src, bram_dst, BUF_SIZE);
+
+#ifdef DDR4CH1_IS_ENABLED
+    // Carved out of the heap, which lives in DDR4CH1 after the cold sections
+    arena_t ddr;
+    size_t ddr_size = 2 * (BUF_SIZE + ARENA_ALIGN_LINE);
+    void* ddr_memory = malloc(ddr_size);
+    if (ddr_memory == NULL || (uintptr_t)ddr_memory < DDR4CH1_BASEADDR || (uintptr_t)ddr_memory >= DDR4CH1_ENDADDR) {
+        printf("DDR4CH1: skipped, the heap is not in DDR4CH1\n\r");
+        return 0;
+    }
+    arena_init(&ddr, (uintptr_t)ddr_memory, ddr_size);
+    uint8_t* ddr_src = arena_alloc(&ddr, BUF_SIZE, ARENA_ALIGN_LINE);
+    uint8_t* ddr_dst = arena_alloc(&ddr, BUF_SIZE, ARENA_ALIGN_LINE);
+    run_bench("DDR4CH1", ddr_src, ddr_dst, BUF_SIZE);
+#endif
+
+    return 0;
+}
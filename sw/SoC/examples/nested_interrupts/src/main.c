@@ -0,0 +1,127 @@
+// Description:
+//      This code measures the worst-case latency of a high-priority interrupt source, with and
+//      without nested interrupts (plic_set_nesting()).
+//          - TIM0 (priority 1) runs a long handler, busy until LOW_BUSY_CYCLES timer cycles
+//            elapsed since its expiry.
+//          - TIM1 (priority 2) is latency-critical: its handler reads the timer counter to
+//            compute how many timer cycles elapsed since it expired (TLR - TCR).
+//      Both durations are in timer cycles, so they do not depend on the core to timer clock
+//      ratio. The TIM0 handler is kept well below the TIM1 period: the latency is measured
+//      modulo the period (auto-reload), a longer wait would wrap and hide the blocking.
+//      Without nesting, a TIM1 expiry that hits while the TIM0 handler runs waits for it to
+//      complete. With nesting, TIM1 preempts the TIM0 handler.
+//
+//      Note: both timers are expected to be connected to the PLIC, not to the core's TIM line.
+//
+
+#include "uninasoc.h"
+#include <stdint.h>
+
+// Timer periods, in timer clock cycles (coprime, so that expiries drift over each other)
+#define LOW_PERIOD      50021
+#define HIGH_PERIOD     3001
+
+// Duration of the low-priority handler, in timer clock cycles since the TIM0 expiry
+#define LOW_BUSY_CYCLES (HIGH_PERIOD / 2)
+
+#if LOW_BUSY_CYCLES >= HIGH_PERIOD || LOW_BUSY_CYCLES >= LOW_PERIOD
+#error "LOW_BUSY_CYCLES must be shorter than both timer periods"
+#endif
+
+// High-priority samples per run
+#define NUM_SAMPLES     500
+
+xlnx_tim_t tim_low = {
+    .base_addr = TIM0_BASEADDR,
+    .counter = LOW_PERIOD,
+    .reload_mode = TIM_RELOAD_AUTO,
+    .count_direction = TIM_COUNT_DOWN
+};
+
+xlnx_tim_t tim_high = {
+    .base_addr = TIM1_BASEADDR,
+    .counter = HIGH_PERIOD,
+    .reload_mode = TIM_RELOAD_AUTO,
+    .count_direction = TIM_COUNT_DOWN
+};
+
+// High-priority latency statistics, in timer clock cycles
+volatile uint32_t samples;
+volatile uint32_t max_latency;
+volatile uint64_t total_latency;
+
+void low_handler(void* arg)
+{
+    // Acknowledge first, the busy time models the actual work
+    xlnx_tim_clear_int(&tim_low);
+
+    // Counting down from LOW_PERIOD since the expiry
+    while (LOW_PERIOD - xlnx_tim_get_value(&tim_low) < LOW_BUSY_CYCLES);
+}
+
+void high_handler(void* arg)
+{
+    // Counting down from HIGH_PERIOD since the expiry
+    uint32_t latency = HIGH_PERIOD - xlnx_tim_get_value(&tim_high);
+    xlnx_tim_clear_int(&tim_high);
+
+    if (samples < NUM_SAMPLES) {
+        samples++;
+        total_latency += latency;
+        if (latency > max_latency)
+            max_latency = latency;
+    }
+}
+
+void run(int nesting)
+{
+    samples = 0;
+    max_latency = 0;
+    total_latency = 0;
+
+    plic_init();
+    plic_register_handler(PLIC_TIM0_INTERRUPT, low_handler, NULL, 1);
+    plic_register_handler(PLIC_TIM1_INTERRUPT, high_handler, NULL, 2);
+    plic_set_nesting(nesting);
+
+    xlnx_tim_configure(&tim_low);
+    xlnx_tim_configure(&tim_high);
+    xlnx_tim_enable_int(&tim_low);
+    xlnx_tim_enable_int(&tim_high);
+    xlnx_tim_start(&tim_low);
+    xlnx_tim_start(&tim_high);
+
+    // Sleep between interrupts
+    while (samples < NUM_SAMPLES) {
+        asm volatile("wfi");
+    }
+
+    xlnx_tim_stop(&tim_low);
+    xlnx_tim_stop(&tim_high);
+    xlnx_tim_clear_int(&tim_low);
+    xlnx_tim_clear_int(&tim_high);
+    plic_unregister_handler(PLIC_TIM0_INTERRUPT);
+    plic_unregister_handler(PLIC_TIM1_INTERRUPT);
+
+    printf("[%s] TIM1 latency over %u samples: max %u, avg %u timer cycles (TIM0 handlers: %u)\r\n",
+        nesting ? "nested" : "flat",
+        NUM_SAMPLES,
+        max_latency,
+        (uint32_t)(total_latency / NUM_SAMPLES),
+        plic_get_count(PLIC_TIM0_INTERRUPT)
+    );
+}
+
+int main()
+{
+    // Initialize HAL
+    uninasoc_init();
+    perf_init();
+
+    printf("Nested Interrupts Latency Test\r\n");
+
+    run(0);
+    run(1);
+
+    return 0;
+}
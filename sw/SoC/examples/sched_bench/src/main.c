@@ -0,0 +1,91 @@
+// Description:
+//      Cooperative scheduler example and context-switch benchmark (sched.h).
+//          - Two tasks yield to each other NUM_YIELDS times: the elapsed core cycles divided
+//            by the number of switches give the cost of sched_yield(), context switch included.
+//          - Two tasks sleep on the TIM0 tick with different periods, while the core idles in
+//            wfi between ticks.
+//
+//      Note: TIM0 is expected to be connected to the PLIC.
+//
+
+#include "uninasoc.h"
+#include <stdint.h>
+
+#define STACK_SIZE      1024
+#define NUM_YIELDS      1000
+#define TICK_PERIOD     10000   // Timer clock cycles
+#define NUM_WAKEUPS     10
+
+uint8_t stack_a[STACK_SIZE] __attribute__((aligned(16)));
+uint8_t stack_b[STACK_SIZE] __attribute__((aligned(16)));
+task_t task_a;
+task_t task_b;
+
+uint32_t wakeups_a;
+uint32_t wakeups_b;
+
+void ping_pong(void* arg)
+{
+    for (uint32_t i = 0; i < NUM_YIELDS; i++) {
+        sched_yield();
+    }
+}
+
+void sleeper(void* arg)
+{
+    uint32_t* wakeups = (uint32_t*)arg;
+    // Task A wakes up every tick, task B every 3 ticks
+    uint32_t period = (wakeups == &wakeups_a) ? 1 : 3;
+    uint32_t deadline = sched_get_ticks();
+
+    for (uint32_t i = 0; i < NUM_WAKEUPS; i++) {
+        // Absolute deadlines, the period does not drift with the task run time
+        deadline += period;
+        sched_sleep_until(deadline);
+        (*wakeups)++;
+    }
+}
+
+int main()
+{
+    uint32_t begin;
+    uint32_t cycles;
+    uint32_t switches;
+
+    // Initialize HAL
+    uninasoc_init();
+    perf_init();
+
+    printf("Cooperative Scheduler Test\r\n");
+
+    // Context switch cost
+    sched_init();
+    sched_create(&task_a, ping_pong, NULL, stack_a, STACK_SIZE);
+    sched_create(&task_b, ping_pong, NULL, stack_b, STACK_SIZE);
+
+    begin = perf_cycles32();
+    sched_run();
+    cycles = perf_cycles32() - begin;
+    switches = task_a.switches + task_b.switches;
+
+    printf("[yield] %u switches in %u cycles: %u cycles/switch\r\n", switches, cycles, cycles / switches);
+
+    // Tick-driven sleep
+    plic_init();
+    plic_register_handler(PLIC_TIM0_INTERRUPT, sched_tick_handler, NULL, 1);
+
+    sched_init();
+    sched_create(&task_a, sleeper, &wakeups_a, stack_a, STACK_SIZE);
+    sched_create(&task_b, sleeper, &wakeups_b, stack_b, STACK_SIZE);
+    sched_start_tick(TICK_PERIOD);
+
+    begin = perf_cycles32();
+    sched_run();
+    cycles = perf_cycles32() - begin;
+    sched_stop_tick();
+
+    printf("[sleep] task A woke up %u times, task B %u times, in %u ticks (%u cycles)\r\n",
+        wakeups_a, wakeups_b, sched_get_ticks(), cycles);
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+// Description:
+//      Deferred binary logging example (trace.h).
+//      It compares the core cycles spent by printf() and by TRACE() for the same message,
+//      then dumps the trace ring on UART. Decode the output on the host with:
+//          python3 sw/host/trace/trace_decode.py bin/trace_log.elf <uart_log>
+//
+
+#include "uninasoc.h"
+#include <stdint.h>
+
+#define NUM_ITERATIONS 16
+
+int main()
+{
+    uint32_t printf_cycles = 0;
+    uint32_t trace_cycles = 0;
+    uint32_t begin;
+
+    // Initialize HAL
+    uninasoc_init();
+    perf_init();
+    trace_init();
+
+    printf("Deferred Logging Test\r\n");
+
+    for (uint32_t i = 0; i < NUM_ITERATIONS; i++) {
+        begin = perf_cycles32();
+        printf("iteration %u: value 0x%08x\r\n", i, i * 0x1234);
+        printf_cycles += perf_cycles32() - begin;
+
+        begin = perf_cycles32();
+        TRACE("iteration %u: value 0x%08x", i, i * 0x1234);
+        trace_cycles += perf_cycles32() - begin;
+    }
+
+    printf("printf: %u cycles/call, TRACE: %u cycles/call\r\n",
+        printf_cycles / NUM_ITERATIONS,
+        trace_cycles / NUM_ITERATIONS
+    );
+
+    trace_dump();
+
+    return 0;
+}
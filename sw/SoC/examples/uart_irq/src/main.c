@@ -0,0 +1,70 @@
+// Description:
+//      Interrupt-driven UART example (xlnx_uart.h).
+//          - Compares the core cycles spent logging a line with TinyIO printf() (busy-waiting
+//            on the UART) against xlnx_uart_puts() (copy into the TX ring).
+//          - Then echoes the received characters, sleeping with wfi between interrupts.
+//
+//      Note: on HPC the virtual UART does not raise the core interrupt, the loop falls back to
+//      xlnx_uart_poll().
+//
+
+#include "uninasoc.h"
+#include <stdint.h>
+
+#define LOG_LINE "[uart_irq] the quick brown fox jumps over the lazy dog\r\n"
+
+xlnx_uart_t uart = {
+    .base_addr = UART_BASEADDR
+};
+
+void uart_handler(void* arg)
+{
+    xlnx_uart_irq_handler((xlnx_uart_t*)arg);
+}
+
+int main()
+{
+    uint32_t printf_cycles;
+    uint32_t ring_cycles;
+    uint32_t begin;
+
+    // Initialize HAL
+    uninasoc_init();
+    perf_init();
+
+    printf("Interrupt-driven UART Test\r\n");
+
+    // Blocking path
+    begin = perf_cycles32();
+    printf(LOG_LINE);
+    printf_cycles = perf_cycles32() - begin;
+
+    // Buffered path
+    xlnx_uart_init(&uart);
+    plic_init();
+    plic_register_handler(PLIC_UART_INTERRUPT, uart_handler, &uart, 1);
+
+    begin = perf_cycles32();
+    xlnx_uart_puts(&uart, LOG_LINE);
+    ring_cycles = perf_cycles32() - begin;
+
+    // Do not interleave with printf
+    xlnx_uart_flush(&uart);
+    printf("printf: %u cycles, xlnx_uart_puts: %u cycles\r\n", printf_cycles, ring_cycles);
+    printf("Type something, it will be echoed back\r\n");
+
+    // Echo
+    while (1) {
+        int c;
+#ifdef IS_EMBEDDED
+        asm volatile("wfi");
+#else
+        xlnx_uart_poll(&uart);
+#endif
+        while ((c = xlnx_uart_getc(&uart)) >= 0) {
+            xlnx_uart_putc(&uart, (char)c);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+// Description:
+//  This file defines a simple allocator to carve aligned buffers (e.g. accelerator tensors)
+//  out of the memory blocks exported by the generated linker script (_<BLOCK>_start/_end).
+//  Two modes are supported:
+//      - Arena: bump allocation with arbitrary power-of-two alignment, freed all at once
+//        (or rolled back to a previous mark)
+//      - Pool: fixed-size blocks carved from an arena, with O(1) alloc and free
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "uninasoc_map.h"
+
+// Memory block bounds (generated memory map). The whole block, also holding the cold sections
+// and the heap (heap.h)
+#ifdef DDR4CH1_IS_ENABLED
+#define DDR4CH1_BASEADDR ((uintptr_t)MAP_DDR4CH1_BASEADDR)
+#define DDR4CH1_ENDADDR  ((uintptr_t)(MAP_DDR4CH1_BASEADDR + MAP_DDR4CH1_SIZE))
+#endif
+
+// Common alignments
+#define ARENA_ALIGN_WORD    sizeof(uintptr_t)
+#define ARENA_ALIGN_LINE    64      // HBUS data width (512 bits) and HLS m_axi alignment
+#define ARENA_ALIGN_PAGE    4096    // AXI bursts never cross a 4KB boundary
+
+typedef struct {
+    uintptr_t base;     // First byte of the region
+    uintptr_t end;      // First byte after the region
+    uintptr_t top;      // Next free byte
+} arena_t;
+
+typedef struct {
+    void* free_list;    // Singly-linked list of free blocks
+    size_t block_size;  // Size of each block, rounded up to its alignment
+    size_t num_blocks;
+    size_t free_blocks;
+} pool_t;
+
+// All the Functions return UNINASOC_ERROR in case of error and UNINASOC_OK otherwise,
+// allocation functions return NULL in case of error
+
+// Initialize an arena over [base, base + size)
+int arena_init(arena_t* arena, uintptr_t base, size_t size);
+
+// Allocate size bytes aligned to align (a power of two)
+void* arena_alloc(arena_t* arena, size_t size, size_t align);
+
+// Release all the allocations
+void arena_reset(arena_t* arena);
+
+// Get the current position, to roll back all the following allocations with arena_release()
+uintptr_t arena_mark(arena_t* arena);
+int arena_release(arena_t* arena, uintptr_t mark);
+
+// Bytes still available in the arena (not accounting for alignment padding)
+size_t arena_available(arena_t* arena);
+
+// Initialize a pool of num_blocks blocks of block_size bytes, each aligned to align,
+// carved out from arena
+int pool_init(pool_t* pool, arena_t* arena, size_t block_size, size_t num_blocks, size_t align);
+
+// Get a block from the pool
+void* pool_alloc(pool_t* pool);
+
+// Return a block to the pool
+void pool_free(pool_t* pool, void* block);
+
+#endif
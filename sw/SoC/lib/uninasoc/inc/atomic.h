@@ -0,0 +1,277 @@
+// Description:
+//  This file defines atomic operations and spinlocks built from LR/SC (Zalrsc) only, since the
+//  memory system supports exclusive accesses but not AMOs:
+//      - lr.w/sc.w on 32-bit values, lr.d/sc.d on 64-bit values (RV64 only)
+//      - *_ptr variants on XLEN-wide values (uintptr_t)
+//  All the read-modify-write operations are sequentially consistent (lr.aqrl, sc.rl).
+//
+//  Note: on HPC, exclusive accesses are only supported by the system cache (C_ENABLE_EXCLUSIVE),
+//  i.e. in DDR. Variables accessed with LR/SC must not be in BRAM (e.g. allocate them with
+//  malloc(), see heap.h), otherwise SC never succeeds.
+//  Note: on a single hart, the contenders are the interrupt handlers. A handler must never wait
+//  for a spinlock held by the code it interrupted: use spin_lock_irqsave() on that side.
+//  Note: without the A extension in -march (e.g. CORE_CV32E40P, CORE_IBEX, see config.mk) the
+//  operations are made atomic against interrupts by masking them (single hart only).
+//  CORE_PICORV32 cannot even do that: they compile to plain accesses.
+
+#ifndef ATOMIC_H
+#define ATOMIC_H
+
+#include <stdint.h>
+
+// Fences
+#define atomic_fence()          asm volatile("fence rw, rw" ::: "memory")
+#define atomic_acquire_fence()  asm volatile("fence r, rw" ::: "memory")
+#define atomic_release_fence()  asm volatile("fence rw, w" ::: "memory")
+
+// Load with acquire and store with release semantics, for flags and indices
+static inline uint32_t atomic_load_acquire32(const volatile uint32_t* addr)
+{
+    uint32_t value = *addr;
+    atomic_acquire_fence();
+    return value;
+}
+
+static inline void atomic_store_release32(volatile uint32_t* addr, uint32_t value)
+{
+    atomic_release_fence();
+    *addr = value;
+}
+
+#ifdef __riscv_atomic
+
+// Read-modify-write loops, with the operation expressed as a single instruction
+// computing the new value (%1) from the old one (%0) and the operand (%3)
+#define ATOMIC_RMW(suffix, op, addr, operand, old)                              \
+    do {                                                                        \
+        __typeof__(old) _new;                                                   \
+        asm volatile(                                                           \
+            "1: lr." suffix ".aqrl %0, (%2)\n"                                  \
+            "   " op "\n"                                                       \
+            "   sc." suffix ".rl %1, %1, (%2)\n"                                \
+            "   bnez %1, 1b\n"                                                  \
+            : "=&r"(old), "=&r"(_new)                                           \
+            : "r"(addr), "r"(operand)                                           \
+            : "memory");                                                        \
+    } while (0)
+
+// Compare-and-swap, returns the old value (success if it equals expected)
+#define ATOMIC_CAS(suffix, addr, expected, desired, old)                        \
+    do {                                                                        \
+        uintptr_t _fail;                                                        \
+        asm volatile(                                                           \
+            "1: lr." suffix ".aqrl %0, (%2)\n"                                  \
+            "   bne %0, %3, 2f\n"                                               \
+            "   sc." suffix ".rl %1, %4, (%2)\n"                                \
+            "   bnez %1, 1b\n"                                                  \
+            "2:\n"                                                              \
+            : "=&r"(old), "=&r"(_fail)                                          \
+            : "r"(addr), "r"(expected), "r"(desired)                            \
+            : "memory");                                                        \
+    } while (0)
+
+static inline uint32_t atomic_fetch_add32(volatile uint32_t* addr, uint32_t value)
+{
+    uint32_t old;
+#if __riscv_xlen == 64
+    // Keep the sum sign-extended as lr.w does
+    ATOMIC_RMW("w", "addw %1, %0, %3", addr, value, old);
+#else
+    ATOMIC_RMW("w", "add %1, %0, %3", addr, value, old);
+#endif
+    return old;
+}
+
+static inline uint32_t atomic_swap32(volatile uint32_t* addr, uint32_t value)
+{
+    uint32_t old;
+    ATOMIC_RMW("w", "mv %1, %3", addr, value, old);
+    return old;
+}
+
+static inline uint32_t atomic_cas32(volatile uint32_t* addr, uint32_t expected, uint32_t desired)
+{
+    uint32_t old;
+#if __riscv_xlen == 64
+    // lr.w sign-extends, so must the comparison value
+    ATOMIC_CAS("w", addr, (int64_t)(int32_t)expected, desired, old);
+#else
+    ATOMIC_CAS("w", addr, expected, desired, old);
+#endif
+    return old;
+}
+
+#if __riscv_xlen == 64
+
+static inline uint64_t atomic_fetch_add64(volatile uint64_t* addr, uint64_t value)
+{
+    uint64_t old;
+    ATOMIC_RMW("d", "add %1, %0, %3", addr, value, old);
+    return old;
+}
+
+static inline uint64_t atomic_swap64(volatile uint64_t* addr, uint64_t value)
+{
+    uint64_t old;
+    ATOMIC_RMW("d", "mv %1, %3", addr, value, old);
+    return old;
+}
+
+static inline uint64_t atomic_cas64(volatile uint64_t* addr, uint64_t expected, uint64_t desired)
+{
+    uint64_t old;
+    ATOMIC_CAS("d", addr, expected, desired, old);
+    return old;
+}
+
+#endif // __riscv_xlen == 64
+
+#else // __riscv_atomic
+
+// No LR/SC: mask the interrupts around the plain accesses
+static inline uintptr_t atomic_irq_save()
+{
+    uintptr_t mstatus = 0;
+#ifndef CORE_PICORV32
+    asm volatile("csrrc %0, mstatus, 0x8" : "=r"(mstatus) :: "memory");
+#endif
+    return mstatus;
+}
+
+static inline void atomic_irq_restore(uintptr_t mstatus)
+{
+#ifndef CORE_PICORV32
+    if (mstatus & 0x8) {
+        asm volatile("csrs mstatus, 0x8" ::: "memory");
+    }
+#endif
+}
+
+static inline uint32_t atomic_fetch_add32(volatile uint32_t* addr, uint32_t value)
+{
+    uintptr_t mstatus = atomic_irq_save();
+    uint32_t old = *addr;
+    *addr = old + value;
+    atomic_irq_restore(mstatus);
+    return old;
+}
+
+static inline uint32_t atomic_swap32(volatile uint32_t* addr, uint32_t value)
+{
+    uintptr_t mstatus = atomic_irq_save();
+    uint32_t old = *addr;
+    *addr = value;
+    atomic_irq_restore(mstatus);
+    return old;
+}
+
+static inline uint32_t atomic_cas32(volatile uint32_t* addr, uint32_t expected, uint32_t desired)
+{
+    uintptr_t mstatus = atomic_irq_save();
+    uint32_t old = *addr;
+    if (old == expected) {
+        *addr = desired;
+    }
+    atomic_irq_restore(mstatus);
+    return old;
+}
+
+#if __riscv_xlen == 64
+
+static inline uint64_t atomic_fetch_add64(volatile uint64_t* addr, uint64_t value)
+{
+    uintptr_t mstatus = atomic_irq_save();
+    uint64_t old = *addr;
+    *addr = old + value;
+    atomic_irq_restore(mstatus);
+    return old;
+}
+
+static inline uint64_t atomic_swap64(volatile uint64_t* addr, uint64_t value)
+{
+    uintptr_t mstatus = atomic_irq_save();
+    uint64_t old = *addr;
+    *addr = value;
+    atomic_irq_restore(mstatus);
+    return old;
+}
+
+static inline uint64_t atomic_cas64(volatile uint64_t* addr, uint64_t expected, uint64_t desired)
+{
+    uintptr_t mstatus = atomic_irq_save();
+    uint64_t old = *addr;
+    if (old == expected) {
+        *addr = desired;
+    }
+    atomic_irq_restore(mstatus);
+    return old;
+}
+
+#endif // __riscv_xlen == 64
+
+#endif // __riscv_atomic
+
+// XLEN-wide variants (pointers, indices)
+#if __riscv_xlen == 64
+#define atomic_fetch_add_ptr(addr, value)           ((uintptr_t)atomic_fetch_add64((volatile uint64_t*)(addr), (value)))
+#define atomic_swap_ptr(addr, value)                ((uintptr_t)atomic_swap64((volatile uint64_t*)(addr), (value)))
+#define atomic_cas_ptr(addr, expected, desired)     ((uintptr_t)atomic_cas64((volatile uint64_t*)(addr), (expected), (desired)))
+#else
+#define atomic_fetch_add_ptr(addr, value)           ((uintptr_t)atomic_fetch_add32((volatile uint32_t*)(addr), (value)))
+#define atomic_swap_ptr(addr, value)                ((uintptr_t)atomic_swap32((volatile uint32_t*)(addr), (value)))
+#define atomic_cas_ptr(addr, expected, desired)     ((uintptr_t)atomic_cas32((volatile uint32_t*)(addr), (expected), (desired)))
+#endif
+
+// Spinlock (test and test-and-set)
+typedef struct {
+    volatile uint32_t locked;
+} spinlock_t;
+
+#define SPINLOCK_INIT { .locked = 0 }
+
+static inline void spin_init(spinlock_t* lock)
+{
+    lock->locked = 0;
+}
+
+// Returns 1 if the lock was taken, 0 otherwise
+static inline int spin_trylock(spinlock_t* lock)
+{
+    return lock->locked == 0 && atomic_swap32(&lock->locked, 1) == 0;
+}
+
+static inline void spin_lock(spinlock_t* lock)
+{
+    while (atomic_swap32(&lock->locked, 1) != 0) {
+        // Spin on plain loads, not to keep the reservation busy
+        while (lock->locked != 0);
+    }
+}
+
+static inline void spin_unlock(spinlock_t* lock)
+{
+    atomic_store_release32(&lock->locked, 0);
+}
+
+// Take the lock with interrupts disabled, returns the mstatus to restore
+static inline uintptr_t spin_lock_irqsave(spinlock_t* lock)
+{
+    uintptr_t mstatus = 0;
+#ifndef CORE_PICORV32
+    asm volatile("csrrc %0, mstatus, 0x8" : "=r"(mstatus));
+#endif
+    spin_lock(lock);
+    return mstatus;
+}
+
+static inline void spin_unlock_irqrestore(spinlock_t* lock, uintptr_t mstatus)
+{
+    spin_unlock(lock);
+#ifndef CORE_PICORV32
+    if (mstatus & 0x8) {
+        asm volatile("csrs mstatus, 0x8");
+    }
+#endif
+}
+
+#endif
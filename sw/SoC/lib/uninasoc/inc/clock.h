@@ -0,0 +1,94 @@
+// Description:
+//  This file defines a monotonic 64-bit clocksource for firmware timing.
+//  Both counters of a timer instance (TIM1 by default) run in cascade mode as a single
+//  free-running 64-bit counter, clocked by the peripheral bus (PBUS_CLOCK_FREQ_MHZ, generated
+//  in uninasoc_conf.h): it never wraps in practice (thousands of years at 250 MHz).
+//  The counter is read without locks (high, low, high again), so it can be used from any
+//  context, interrupt handlers included.
+//  Deadlines are absolute tick values: comparing them with the current tick needs no
+//  wrap-around handling.
+//
+//  Note: the clocksource owns the whole timer instance, do not use it for other purposes
+//  (e.g. the profiler, prof.h, also uses TIM1). Override CLOCK_BASEADDR to use TIM0.
+//
+//  Example:
+//      clock_init();
+//      uint64_t deadline = clock_deadline_us(500);
+//      while (!clock_expired(deadline) && !done) { ... }
+//      clock_delay_us(10);
+
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdint.h>
+
+// Timer instance used as clocksource
+#ifndef CLOCK_BASEADDR
+#define CLOCK_BASEADDR TIM1_BASEADDR
+#endif
+
+// Counter frequency, can be overridden at build time
+#ifndef CLOCK_FREQ_MHZ
+#define CLOCK_FREQ_MHZ PBUS_CLOCK_FREQ_MHZ
+#endif
+
+// All the Functions return UNINASOC_ERROR in case of error and UNINASOC_OK otherwise
+
+// Start the clocksource from 0
+int clock_init();
+
+// Current tick, 1 / CLOCK_FREQ_MHZ microseconds each
+uint64_t clock_ticks();
+
+// Conversions, exact when 1000 is a multiple of CLOCK_FREQ_MHZ (e.g. 10, 100 or 250 MHz)
+static inline uint64_t clock_ticks_to_ns(uint64_t ticks)
+{
+#if (1000 % CLOCK_FREQ_MHZ) == 0
+    return ticks * (1000 / CLOCK_FREQ_MHZ);
+#else
+    // Split, not to overflow ticks * 1000
+    return (ticks / CLOCK_FREQ_MHZ) * 1000 + ((ticks % CLOCK_FREQ_MHZ) * 1000) / CLOCK_FREQ_MHZ;
+#endif
+}
+
+static inline uint64_t clock_ticks_to_us(uint64_t ticks)
+{
+    return ticks / CLOCK_FREQ_MHZ;
+}
+
+static inline uint64_t clock_us_to_ticks(uint64_t us)
+{
+    return us * CLOCK_FREQ_MHZ;
+}
+
+// Time since clock_init()
+static inline uint64_t clock_now_ns()
+{
+    return clock_ticks_to_ns(clock_ticks());
+}
+
+static inline uint64_t clock_now_us()
+{
+    return clock_ticks_to_us(clock_ticks());
+}
+
+// Deadline us microseconds from now
+static inline uint64_t clock_deadline_us(uint64_t us)
+{
+    return clock_ticks() + clock_us_to_ticks(us);
+}
+
+// Returns 1 if the deadline has passed, 0 otherwise
+static inline int clock_expired(uint64_t deadline)
+{
+    return clock_ticks() >= deadline;
+}
+
+// Busy-wait for us microseconds (at least)
+static inline void clock_delay_us(uint64_t us)
+{
+    uint64_t deadline = clock_deadline_us(us);
+    while (!clock_expired(deadline));
+}
+
+#endif
@@ -0,0 +1,86 @@
+// Description:
+//  This file defines a general-purpose allocator for bare-metal applications, complementing
+//  the arena and pool allocators (arena.h):
+//      - Arena: init-time data, never freed one by one
+//      - Pool: hot fixed-size objects
+//      - Heap: everything else, with alloc and free of arbitrary sizes
+//  The heap is a segregated-fit allocator: free blocks are kept in one list per power-of-two
+//  size class, with boundary tags for O(1) coalescing on free. Allocation takes the first block
+//  of the first non-empty class that is guaranteed to fit, so its cost is bounded by the number
+//  of classes (XLEN) and does not depend on the number of free blocks.
+//
+//  The generated linker script exports the heap region (_heap_start/_heap_end): the largest
+//  memory block other than the boot one (e.g. DDR), after the cold sections (section.h).
+//  The region is empty if the SoC only has the boot memory. malloc(), calloc(), realloc() and free() (stdlib.h) use a default
+//  heap over that region, initialized on first use.
+//  Note: arenas over a memory block (e.g. DDR4CH1_BASEADDR) overlap the cold sections and the
+//  heap: carve them out of the heap instead, as in the example below.
+//  Note: allocation functions are not interrupt-safe, do not call them from handlers.
+//
+//  Example, init-time arena and hot pool carved from the heap:
+//      arena_t arena;
+//      pool_t pool;
+//      void* init_data = heap_alloc(&uninasoc_heap, 4096, ARENA_ALIGN_LINE);
+//      arena_init(&arena, (uintptr_t)init_data, 4096);
+//      pool_init(&pool, &arena, sizeof(packet_t), 32, ARENA_ALIGN_WORD);
+
+#ifndef HEAP_H
+#define HEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Import linker script symbols
+extern const volatile uintptr_t _heap_start;
+extern const volatile uintptr_t _heap_end;
+
+#define HEAP_BASEADDR ((uintptr_t)&_heap_start)
+#define HEAP_ENDADDR  ((uintptr_t)&_heap_end)
+
+// Minimum alignment of the returned pointers
+#define HEAP_ALIGN      (2 * sizeof(uintptr_t))
+
+// One size class per power of two
+#define HEAP_NUM_BINS   (8 * sizeof(uintptr_t))
+
+typedef struct heap_block heap_block_t;
+
+typedef struct {
+    uintptr_t base;                         // First block
+    uintptr_t end;                          // End sentinel
+    heap_block_t* bins[HEAP_NUM_BINS];      // Free lists, bins[i] holds sizes in [2^i, 2^(i+1))
+    uintptr_t bitmap;                       // Non-empty bins
+    size_t used;                            // Allocated bytes, block headers included
+    size_t peak;                            // Maximum of used
+} heap_t;
+
+// Default heap over [_heap_start, _heap_end)
+extern heap_t uninasoc_heap;
+
+// All the Functions return UNINASOC_ERROR in case of error and UNINASOC_OK otherwise,
+// allocation functions return NULL in case of error
+
+// Initialize a heap over [base, base + size)
+int heap_init(heap_t* heap, uintptr_t base, size_t size);
+
+// Allocate size bytes aligned to align (a power of two, at least HEAP_ALIGN is used)
+void* heap_alloc(heap_t* heap, size_t size, size_t align);
+
+// Return a block to the heap, ptr can be NULL
+void heap_free(heap_t* heap, void* ptr);
+
+// Resize a block, moving its content if needed
+void* heap_realloc(heap_t* heap, void* ptr, size_t size);
+
+// Usable bytes of an allocated block (at least the requested size)
+size_t heap_usable_size(void* ptr);
+
+// Bytes currently allocated and maximum reached, block headers included
+size_t heap_get_used(heap_t* heap);
+size_t heap_get_peak(heap_t* heap);
+
+// Bytes in free blocks, and size of the largest free block
+size_t heap_get_free(heap_t* heap);
+size_t heap_get_largest_free(heap_t* heap);
+
+#endif
@@ -0,0 +1,130 @@
+// Description:
+//  This file defines the API to adoperate the HLS CONV2D accelerator (custom_hls_conv_hbus)
+//  Jobs are submitted asynchronously and their completion is signaled through the
+//  PLIC external interrupt (PLIC_HLS_INTERRUPT), so that the core can either wait in
+//  wfi or keep doing useful work while the kernel runs.
+//  Submitted jobs are kept in a software queue: the arguments of the next job are written
+//  as soon as the kernel raises ap_ready for the running one, so consecutive jobs are
+//  launched back to back without waiting for the core.
+//  The driver keeps shadow copies of the configuration and argument registers: only the
+//  live status (ISR, and ap_idle on completion) is read back from the accelerator, and
+//  unchanged arguments are not rewritten, since every access crosses the clock, data-width
+//  and protocol converters.
+
+#ifndef HLS_CONV_H
+#define HLS_CONV_H
+
+#include <stdint.h>
+#include "queue.h"
+#include "uninasoc_map.h"
+
+// Base address (generated memory map)
+#define HLS_CONTROL_BASEADDR ((uintptr_t)MAP_HLS_CONTROL_BASEADDR)
+
+// Submission queue depth (must be a power of two)
+#ifndef HLS_CONV_QUEUE_DEPTH
+#define HLS_CONV_QUEUE_DEPTH 8
+#endif
+
+// Completion callback, invoked from the external interrupt handler context
+typedef void (*hls_conv_callback_t)(void* arg);
+
+// Convolution job descriptor
+typedef struct {
+    // Buffer addresses are XLEN-wide, the upper 32 bits are programmed on RV64
+    uintptr_t input;                // Input activation tensor address   (I[N][C][Y][X])
+    uintptr_t weights;              // Filter weights tensor address     (W[K][C][R][S])
+    uintptr_t output;               // Output activation tensor address  (O[N][K][Y'][X'])
+    uint8_t n;                      // Input batch
+    uint8_t c;                      // Input channels
+    uint8_t k;                      // Output channels
+    hls_conv_callback_t callback;   // Optional, can be NULL
+    void* callback_arg;
+    // Timestamps in core cycles (mcycle), filled by the driver
+    uint32_t submit_cycle;          // Enqueued
+    uint32_t start_cycle;           // Arguments written and ap_start raised
+    uint32_t done_cycle;            // ap_done interrupt serviced
+} hls_conv_job_t;
+
+// Queue statistics, all latencies are in core cycles
+typedef struct {
+    uint32_t jobs;                  // Completed jobs
+    uint32_t max_depth;             // Maximum number of queued + in-flight jobs
+    uint64_t total_latency;         // Sum of submit-to-done latencies
+    uint32_t max_latency;           // Worst submit-to-done latency
+    uint32_t first_start_cycle;     // Start of the first job
+    uint32_t last_done_cycle;       // Completion of the last job
+    uint32_t launches;              // Launched jobs
+    uint32_t launch_cycles;         // Cycles spent programming and starting the kernel
+    uint32_t mmio_writes;           // Register writes issued on launch
+} hls_conv_stats_t;
+
+// Shadow copies of the accelerator registers, as last written by the driver
+typedef struct {
+    uint32_t gie;
+    uint32_t ier;
+    uint32_t i;
+    uint32_t i_hi;
+    uint32_t w;
+    uint32_t w_hi;
+    uint32_t o;
+    uint32_t o_hi;
+    uint32_t n;
+    uint32_t c;
+    uint32_t k;
+} hls_conv_regs_t;
+
+// Need to be initialized with HLS_CONTROL_BASEADDR
+typedef struct {
+    uintptr_t base_addr;
+    // Job ring, all indices are free-running
+    hls_conv_job_t* queue[HLS_CONV_QUEUE_DEPTH];
+    volatile uint32_t tail;         // Next free slot
+    volatile uint32_t launch_idx;   // Next job to launch, [launch_idx, tail) are pending
+    volatile uint32_t done_idx;     // Next job to complete, [done_idx, launch_idx) are launched
+    volatile uint32_t staged;       // A job was launched and its ap_ready has not been seen yet
+    hls_conv_regs_t shadow;
+    hls_conv_stats_t stats;
+    // Optional, can be NULL: the handler publishes completed jobs here (wait-free),
+    // for the main loop to collect them with hls_conv_get_completed()
+    spsc_queue_t* completed;
+} hls_conv_t;
+
+// All the Functions return UNINASOC_ERROR in case of error and UNINASOC_OK otherwise
+
+// Initialize the accelerator, synchronize the shadow registers and enable the
+// ap_done and ap_ready interrupts. The job ring, the statistics and the completed
+// queue (if any) are emptied.
+// The PLIC must be configured separately, e.g. with
+// plic_register_handler(PLIC_HLS_INTERRUPT, <handler calling hls_conv_irq_handler>, conv, 1)
+int hls_conv_init(hls_conv_t* conv);
+
+// Enqueue a job, without waiting for completion. The job is launched immediately
+// if the kernel can accept new arguments, otherwise from the ap_ready interrupt.
+// The descriptor must stay valid until completion.
+// Returns UNINASOC_ERROR if the queue is full
+int hls_conv_submit(hls_conv_t* conv, hls_conv_job_t* job);
+
+// Returns 1 if any job is queued or in flight, 0 otherwise.
+// This only reads the software state, with no access to the accelerator registers
+int hls_conv_is_busy(hls_conv_t* conv);
+
+// Wait for all submitted jobs to complete, sleeping in wfi between interrupts.
+// Interrupts are taken while waiting, the caller's mstatus.MIE is preserved
+int hls_conv_wait(hls_conv_t* conv);
+
+// Returns the oldest completed job not collected yet, or NULL.
+// Requires the completed queue, sized for at least HLS_CONV_QUEUE_DEPTH jobs
+hls_conv_job_t* hls_conv_get_completed(hls_conv_t* conv);
+
+// Clear the queue statistics
+void hls_conv_reset_stats(hls_conv_t* conv);
+
+// Completion handler, to be called when the claimed source is PLIC_HLS_INTERRUPT,
+// e.g. from a handler registered with plic_register_handler(). It acknowledges the
+// accelerator interrupt, launches the next queued job on ap_ready and, on ap_done, completes
+// every finished job (completions can coalesce into one interrupt) and runs their callbacks.
+// The PLIC claim/complete is left to the caller
+void hls_conv_irq_handler(hls_conv_t* conv);
+
+#endif
@@ -1,12 +1,43 @@
 // Author: Salvatore Santoro <sal.santoro@studenti.unina.it>
 // Description:
 //  Simple wrapper functions for direct memory I/O
+//  The accessors are relaxed: they only order the accesses to the same device, not against
+//  memory. Use the *_fenced variants or the io_*mb() barriers where a device must see the
+//  memory writes (e.g. a doorbell after filling a buffer), or where memory must be read
+//  after a device status (e.g. a buffer after a done flag). Batches of register writes
+//  need a single barrier before the last one.
+//  The native and block accessors use XLEN-wide accesses: on RV64 each one is a single
+//  bus transaction instead of two 32-bit ones.
 
 #ifndef IO_H
 #define IO_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+// I/O barriers
+#define io_mb()     asm volatile("fence iorw, iorw" ::: "memory")
+// Memory writes before the following device writes
+#define io_wmb()    asm volatile("fence w, o" ::: "memory")
+// Device reads before the following memory reads
+#define io_rmb()    asm volatile("fence i, r" ::: "memory")
+
+#if __riscv_xlen == 64
+static inline void iowrite64(uintptr_t addr, uint64_t val)
+{
+    volatile uint64_t* LocalAddr = (volatile uint64_t*)addr;
+    *LocalAddr = val;
+}
+#else
+// Two 32-bit accesses on RV32, low half first (not atomic)
+static inline void iowrite64(uintptr_t addr, uint64_t val)
+{
+    volatile uint32_t* LocalAddr = (volatile uint32_t*)addr;
+    LocalAddr[0] = (uint32_t)val;
+    LocalAddr[1] = (uint32_t)(val >> 32);
+}
+#endif
+
 static inline void iowrite32(uintptr_t addr, uint32_t val)
 {
     volatile uint32_t* LocalAddr = (volatile uint32_t*)addr;
@@ -25,6 +56,21 @@ static inline void iowrite8(uintptr_t addr, uint8_t val)
     *LocalAddr = val;
 }
 
+#if __riscv_xlen == 64
+static inline uint64_t ioread64(uintptr_t addr)
+{
+    return *(volatile uint64_t*)addr;
+}
+#else
+// Two 32-bit accesses on RV32, low half first (not atomic)
+static inline uint64_t ioread64(uintptr_t addr)
+{
+    volatile uint32_t* LocalAddr = (volatile uint32_t*)addr;
+    uint32_t low = LocalAddr[0];
+    return ((uint64_t)LocalAddr[1] << 32) | low;
+}
+#endif
+
 static inline uint32_t ioread32(uintptr_t addr)
 {
     return *(volatile uint32_t*)addr;
@@ -40,4 +86,81 @@ static inline uint8_t ioread8(uintptr_t addr)
     return *(volatile uint8_t*)addr;
 }
 
+// XLEN-wide accesses
+static inline void iowrite_native(uintptr_t addr, uintptr_t val)
+{
+    *(volatile uintptr_t*)addr = val;
+}
+
+static inline uintptr_t ioread_native(uintptr_t addr)
+{
+    return *(volatile uintptr_t*)addr;
+}
+
+// Ordered against the previous memory writes, e.g. doorbells and start bits
+static inline void iowrite32_fenced(uintptr_t addr, uint32_t val)
+{
+    io_wmb();
+    iowrite32(addr, val);
+}
+
+// Ordered against the following memory reads, e.g. done and status flags
+static inline uint32_t ioread32_fenced(uintptr_t addr)
+{
+    uint32_t val = ioread32(addr);
+    io_rmb();
+    return val;
+}
+
+// FIFO accessors: count XLEN-wide accesses to the same register
+static inline void iowrite_native_rep(uintptr_t addr, const uintptr_t* buf, size_t count)
+{
+    volatile uintptr_t* LocalAddr = (volatile uintptr_t*)addr;
+    for (size_t i = 0; i < count; i++) {
+        *LocalAddr = buf[i];
+    }
+}
+
+static inline void ioread_native_rep(uintptr_t addr, uintptr_t* buf, size_t count)
+{
+    volatile uintptr_t* LocalAddr = (volatile uintptr_t*)addr;
+    for (size_t i = 0; i < count; i++) {
+        buf[i] = *LocalAddr;
+    }
+}
+
+// Buffer copies to and from MMIO, XLEN-wide while both sides are aligned.
+// Unlike memcpy(), every access is performed, in increasing address order
+static inline void memcpy_toio(uintptr_t addr, const void* src, size_t n)
+{
+    const uint8_t* src8 = (const uint8_t*)src;
+
+    if (((addr | (uintptr_t)src8) & (sizeof(uintptr_t) - 1)) == 0) {
+        for (; n >= sizeof(uintptr_t); n -= sizeof(uintptr_t)) {
+            iowrite_native(addr, *(const uintptr_t*)src8);
+            addr += sizeof(uintptr_t);
+            src8 += sizeof(uintptr_t);
+        }
+    }
+    for (; n > 0; n--) {
+        iowrite8(addr++, *src8++);
+    }
+}
+
+static inline void memcpy_fromio(void* dst, uintptr_t addr, size_t n)
+{
+    uint8_t* dst8 = (uint8_t*)dst;
+
+    if (((addr | (uintptr_t)dst8) & (sizeof(uintptr_t) - 1)) == 0) {
+        for (; n >= sizeof(uintptr_t); n -= sizeof(uintptr_t)) {
+            *(uintptr_t*)dst8 = ioread_native(addr);
+            addr += sizeof(uintptr_t);
+            dst8 += sizeof(uintptr_t);
+        }
+    }
+    for (; n > 0; n--) {
+        *dst8++ = ioread8(addr++);
+    }
+}
+
 #endif
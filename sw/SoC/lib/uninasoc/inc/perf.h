@@ -0,0 +1,140 @@
+// Description:
+//  This file defines the API to read the RISC-V performance counters (mcycle, minstret and
+//  mhpmcounter3..8) and to time code regions with them. Counters are read as 64-bit values:
+//  on RV32 the high and low halves are read in a loop until the high half is stable.
+//  Regions accumulate the cycles and retired instructions spent between PERF_BEGIN and
+//  PERF_END (or inside a PERF_SCOPE block) and can be printed on UART with perf_report().
+//
+//  Note: CORE_PICORV32 cannot perform CSR operations, so all the functions compile
+//  to no-ops that return 0 on that core.
+
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Number of implemented mhpmcounters, starting from mhpmcounter3.
+// Defaults are the core configurations used in this SoC, can be overridden at build time
+#ifndef PERF_NUM_HPM_COUNTERS
+#if defined(CORE_CV64A6)
+#define PERF_NUM_HPM_COUNTERS 6
+#else
+#define PERF_NUM_HPM_COUNTERS 0
+#endif
+#endif
+
+#if PERF_NUM_HPM_COUNTERS > 6
+#error "PERF_NUM_HPM_COUNTERS: only mhpmcounter3..8 are supported"
+#endif
+
+// Counters are inhibited at reset on these cores (mcountinhibit)
+#if defined(CORE_CV32E40P) || defined(CORE_IBEX)
+#define PERF_HAS_MCOUNTINHIBIT
+#endif
+
+// Counters snapshot
+typedef struct {
+    uint64_t cycles;
+    uint64_t instret;
+} perf_snapshot_t;
+
+// Timed region, declare with PERF_REGION()
+typedef struct {
+    const char* name;
+    uint32_t count;     // Number of completed measurements
+    uint64_t cycles;    // Accumulated cycles
+    uint64_t instret;   // Accumulated retired instructions
+    uint64_t max_cycles;
+    perf_snapshot_t start;
+} perf_region_t;
+
+#define PERF_REGION(var, region_name) perf_region_t var = { .name = region_name }
+
+#ifndef CORE_PICORV32
+
+// Read a 64-bit counter, on RV32 the high half is re-read to detect a low half overflow
+#if __riscv_xlen == 32
+#define PERF_READ_CSR64(csr)                                                \
+    ({                                                                      \
+        uint32_t __hi, __lo, __hi2;                                         \
+        do {                                                                \
+            asm volatile("csrr %0, " #csr "h" : "=r"(__hi));                \
+            asm volatile("csrr %0, " #csr : "=r"(__lo));                    \
+            asm volatile("csrr %0, " #csr "h" : "=r"(__hi2));               \
+        } while (__hi != __hi2);                                            \
+        ((uint64_t)__hi << 32) | __lo;                                      \
+    })
+#else
+#define PERF_READ_CSR64(csr)                                                \
+    ({                                                                      \
+        uint64_t __val;                                                     \
+        asm volatile("csrr %0, " #csr : "=r"(__val));                       \
+        __val;                                                              \
+    })
+#endif
+
+static inline uint64_t perf_cycles()
+{
+    return PERF_READ_CSR64(mcycle);
+}
+
+static inline uint64_t perf_instret()
+{
+    return PERF_READ_CSR64(minstret);
+}
+
+// Lower 32 bits of the cycle counter, a single CSR read for short intervals
+static inline uint32_t perf_cycles32()
+{
+    uintptr_t cycles;
+    asm volatile("csrr %0, mcycle" : "=r"(cycles));
+    return (uint32_t)cycles;
+}
+
+static inline void perf_snapshot(perf_snapshot_t* snapshot)
+{
+    snapshot->cycles = perf_cycles();
+    snapshot->instret = perf_instret();
+}
+
+#else // CORE_PICORV32
+
+static inline uint64_t perf_cycles() { return 0; }
+static inline uint64_t perf_instret() { return 0; }
+static inline uint32_t perf_cycles32() { return 0; }
+static inline void perf_snapshot(perf_snapshot_t* snapshot)
+{
+    snapshot->cycles = 0;
+    snapshot->instret = 0;
+}
+
+#endif // CORE_PICORV32
+
+// Enable mcycle, minstret and the mhpmcounters (where counters can be inhibited)
+void perf_init();
+
+// Read mhpmcounter<3 + index>, returns 0 if not implemented
+uint64_t perf_hpm_read(uint32_t index);
+
+// Select the core-specific event counted by mhpmcounter<3 + index>
+void perf_hpm_set_event(uint32_t index, uintptr_t event);
+
+// Region timing
+void perf_region_begin(perf_region_t* region);
+void perf_region_end(perf_region_t* region);
+void perf_region_reset(perf_region_t* region);
+
+#define PERF_BEGIN(region)  perf_region_begin(&(region))
+#define PERF_END(region)    perf_region_end(&(region))
+
+// Time the following statement or block, e.g. PERF_SCOPE(region) { ... }
+// Leaving the block with break, return or goto skips the measurement
+#define PERF_SCOPE(region)                                                          \
+    for (int __perf_once = (perf_region_begin(&(region)), 1); __perf_once;          \
+         __perf_once = (perf_region_end(&(region)), 0))
+
+// Print the regions on UART: count, total, average and max cycles, instructions and CPI
+void perf_report(perf_region_t* regions[], size_t num_regions);
+
+#endif
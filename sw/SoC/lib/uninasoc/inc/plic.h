@@ -10,31 +10,64 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include "uninasoc_map.h"
 
-// Import linker script symbol
-extern const volatile uint32_t _peripheral_PLIC_start;
-
-// Base address
-#define PLIC_BASEADDR ((uintptr_t)&_peripheral_PLIC_start)
+// Base address (generated memory map)
+#define PLIC_BASEADDR ((uintptr_t)MAP_PLIC_BASEADDR)
 
 // Registers
+#define PLIC_PRIORITY(source)   (PLIC_BASEADDR + (0x4 * (source)))
 #define PLIC_INT_ENABLE_CTX0    (PLIC_BASEADDR +   0x2000)
+#define PLIC_THRESHOLD_CTX0     (PLIC_BASEADDR + 0x200000)
 #define PLIC_CLAIM_CTX0         (PLIC_BASEADDR + 0x200004)
 #define PLIC_COMPLETE_CTX0      (PLIC_BASEADDR + 0x200004)
 
+// Interrupt sources
+// This mapping is static and must match the PLIC_*_INTERRUPT lines in hw/xilinx/rtl/uninasoc_pkg.sv
+typedef enum {
+    PLIC_RESERVED_INTERRUPT = 0,    // PLIC line 0 is reserved
+    PLIC_GPIOIN_INTERRUPT   = 1,    // GPIO In [embedded only]
+    PLIC_TIM0_INTERRUPT     = 2,    // Timer 0
+    PLIC_TIM1_INTERRUPT     = 3,    // Timer 1
+    PLIC_UART_INTERRUPT     = 4,    // UART
+    PLIC_HLS_INTERRUPT      = 5,    // HLS [HPC only]
+    PLIC_NUM_SOURCES                // Number of lines, including the reserved one
+} plic_source_t;
+
+// Priorities range from 1 (lowest) to PLIC_MAX_PRIORITY, 0 disables the source.
+// A source only interrupts the core if its priority is strictly greater than the threshold
+#define PLIC_MAX_PRIORITY 7
+
+// Source handler, invoked with the interrupt claimed and completed right after it returns.
+// Level-sensitive sources must be acknowledged at the device before returning
+typedef void (*plic_handler_t)(void* arg);
+
 // Functions
 
-// Initialize PLIC peripheral
+// Initialize PLIC peripheral: all sources disabled, priorities and threshold set to 0
 int plic_init();
 
 // This function configures the priorities associated to each peripheral
 // "priorities" is an array of size "source_num" containing
-// the priority values to assign to each peripherals in order
+// the priority values to assign to each peripherals in order, starting from source 1
 void plic_configure(uint32_t* priorities, size_t source_num);
 
-// This function enables the interrupts of each external peripheral
+// This function enables the interrupts of each configured external peripheral
 void plic_enable_all();
 
+// This function sets the priority of a single source (0 means never interrupt)
+void plic_set_priority(plic_source_t source, uint32_t priority);
+
+// This function enables the interrupt of a single source, leaving the others untouched
+void plic_enable(plic_source_t source);
+
+// This function disables the interrupt of a single source, leaving the others untouched
+void plic_disable(plic_source_t source);
+
+// These functions set and get the priority threshold of the core context
+void plic_set_threshold(uint32_t threshold);
+uint32_t plic_get_threshold();
+
 // This function is used to claim the interrupt, the processor will obtain
 // the ID associated to the interrupting peripheral
 // It's supposed to be used inside the external interrupts handler
@@ -45,4 +78,32 @@ uint32_t plic_claim();
 // It's supposed to be used inside the external interrupts handler
 void plic_complete(uint32_t interrupt_id);
 
+// Handler table
+
+// Register the handler of a source, set its priority and enable it.
+// Returns UNINASOC_ERROR for the reserved or out-of-range sources, or an invalid priority
+int plic_register_handler(plic_source_t source, plic_handler_t handler, void* arg, uint32_t priority);
+
+// Disable a source and remove its handler
+void plic_unregister_handler(plic_source_t source);
+
+// Service all the pending interrupts: claim, run the registered handler, complete,
+// and claim again until no source is pending, so a burst costs a single trap.
+// Claimed sources without a handler are disabled, to avoid an interrupt storm.
+// Returns the number of serviced interrupts.
+// This is the default _ext_handler behaviour (irq_handlers.c)
+uint32_t plic_dispatch();
+
+// Number of interrupts serviced by plic_dispatch() for a source
+uint32_t plic_get_count(plic_source_t source);
+
+// Nested interrupts
+// When enabled, plic_dispatch() runs each handler with interrupts re-enabled and the
+// PLIC threshold raised to the priority of the source being serviced, so only strictly
+// higher-priority sources preempt it. mepc and mstatus are saved around the handler,
+// the other registers are saved by the __irq_handler__ prologue of the nested trap.
+// Handlers must be reentrant with respect to the higher-priority ones.
+// Not available on CORE_PICORV32 (no CSR support)
+void plic_set_nesting(int enable);
+
 #endif
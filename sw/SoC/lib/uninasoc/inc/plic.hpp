@@ -0,0 +1,73 @@
+// Description:
+//  This file defines the C++ HAL of the PLIC, context 0 (machine mode), see plic.h for the
+//  C driver and the handler dispatch. Sources are template parameters, so the priority
+//  register of each source is a constant address.
+
+#ifndef PLIC_HPP
+#define PLIC_HPP
+
+#include "reg.hpp"
+
+namespace uninasoc {
+
+// Interrupt sources, must match plic_source_t (plic.h)
+enum class plic_source : unsigned {
+    gpio_in = 1,
+    tim0 = 2,
+    tim1 = 3,
+    uart = 4,
+    hls = 5,
+};
+
+template <uintptr_t Base>
+struct plic_ctrl {
+    static constexpr unsigned max_priority = 7;
+
+    // Registers
+    template <plic_source Source>
+    using priority = reg<Base + 0x4 * static_cast<unsigned>(Source)>;
+    using enable_ctx0 = reg<Base + 0x2000>;
+    using threshold_ctx0 = reg<Base + 0x200000>;
+    using claim_ctx0 = reg<Base + 0x200004>;       // Read to claim, write to complete
+
+    // All sources disabled, threshold set to 0
+    UNINASOC_INLINE static void init()
+    {
+        enable_ctx0::write(0);
+        threshold_ctx0::write(0);
+    }
+
+    // Enable a source with the given priority (1 to max_priority)
+    template <plic_source Source>
+    UNINASOC_INLINE static void enable(uint32_t prio)
+    {
+        priority<Source>::write(prio);
+        enable_ctx0::set_bits(uint32_t(1) << static_cast<unsigned>(Source));
+    }
+
+    template <plic_source Source>
+    UNINASOC_INLINE static void disable()
+    {
+        enable_ctx0::clear_bits(uint32_t(1) << static_cast<unsigned>(Source));
+    }
+
+    UNINASOC_INLINE static void set_threshold(uint32_t value)
+    {
+        threshold_ctx0::write(value);
+    }
+
+    // Highest priority pending source, 0 if none
+    UNINASOC_INLINE static uint32_t claim()
+    {
+        return claim_ctx0::read();
+    }
+
+    UNINASOC_INLINE static void complete(uint32_t id)
+    {
+        claim_ctx0::write(id);
+    }
+};
+
+} // namespace uninasoc
+
+#endif
@@ -0,0 +1,63 @@
+// Description:
+//  This file defines the API of a statistical PC-sampling profiler.
+//  TIM1 periodically interrupts the core through the PLIC (PLIC_TIM1_INTERRUPT), and the
+//  interrupted PC (mepc) is accumulated into a histogram of the .text section
+//  (_text_start, _text_end). The histogram buffer is provided by the user, so it can be
+//  placed either in BRAM or in DDR (e.g. with arena_alloc()).
+//  prof_dump() prints the non-empty buckets on UART, and the host tool in sw/host/profiler
+//  symbolizes them against the application ELF to print a flat profile.
+//
+//  Note: code running with interrupts disabled (e.g. other interrupt handlers) is never
+//  sampled, its time is attributed to the instruction that re-enables the interrupts.
+
+#ifndef PROF_H
+#define PROF_H
+
+#include <stdint.h>
+
+// Import linker script symbols
+extern const volatile uint32_t _text_start;
+extern const volatile uint32_t _text_end;
+
+// Bucket granularity is at least one compressed instruction
+#define PROF_MIN_SHIFT 1
+
+typedef struct {
+    xlnx_tim_t timer;               // Sampling timer, base_addr must be TIM1_BASEADDR
+    uint32_t* buckets;              // Histogram, num_buckets entries
+    uint32_t num_buckets;
+    uint32_t shift;                 // Each bucket covers (1 << shift) bytes of .text
+    uintptr_t text_start;
+    volatile uint32_t samples;      // Samples within .text
+    volatile uint32_t dropped;      // Samples outside .text
+} prof_t;
+
+// All the Functions return UNINASOC_ERROR in case of error and UNINASOC_OK otherwise
+
+// Initialize the profiler with a zeroed histogram buffer and a sampling period,
+// expressed in timer clock cycles. The bucket size is the smallest power of two that
+// maps the whole .text section into num_buckets.
+// The PLIC must be configured separately, e.g. with
+// plic_register_handler(PLIC_TIM1_INTERRUPT, <handler calling prof_irq_handler>, prof, 1)
+int prof_init(prof_t* prof, uint32_t* buckets, uint32_t num_buckets, uint32_t period);
+
+// Start and stop sampling
+int prof_start(prof_t* prof);
+int prof_stop(prof_t* prof);
+
+// Clear the histogram
+void prof_reset(prof_t* prof);
+
+// Sample handler, to be called when the claimed source is PLIC_TIM1_INTERRUPT.
+// It records mepc and acknowledges the timer interrupt.
+// The PLIC claim/complete is left to the caller
+void prof_irq_handler(prof_t* prof);
+
+// Print the histogram on UART, in the format parsed by sw/host/profiler/prof_symbolize.py:
+//      PROF_BEGIN <text_start> <shift> <samples> <dropped>
+//      <bucket address> <count>
+//      ...
+//      PROF_END
+void prof_dump(prof_t* prof);
+
+#endif
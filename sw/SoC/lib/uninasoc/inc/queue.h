@@ -0,0 +1,61 @@
+// Description:
+//  This file defines bounded lock-free ring queues of pointers, to hand work between interrupt
+//  handlers and the main loop without disabling interrupts:
+//      - SPSC: one producer and one consumer (e.g. one handler to the main loop), wait-free,
+//        indices only, no atomic read-modify-write
+//      - MPSC: any number of producers (e.g. handlers at different priorities, with nesting)
+//        and one consumer. Producers claim slots with compare-and-swap (atomic.h) and publish
+//        them with a per-slot sequence number
+//  The storage is provided by the caller and its size must be a power of two.
+//  Note: the MPSC tail is updated with LR/SC, see atomic.h for where it can be placed.
+
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    void** slots;
+    uint32_t mask;              // Size - 1
+    volatile uint32_t head;     // Next slot to pop, written by the consumer only
+    volatile uint32_t tail;     // Next slot to push, written by the producer only
+} spsc_queue_t;
+
+typedef struct {
+    volatile uint32_t sequence; // Slot index when free, index + 1 when published
+    void* volatile data;
+} mpsc_cell_t;
+
+typedef struct {
+    mpsc_cell_t* cells;
+    uint32_t mask;              // Size - 1
+    volatile uint32_t head;     // Next cell to pop, written by the consumer only
+    volatile uint32_t tail;     // Next cell to claim, shared by the producers
+} mpsc_queue_t;
+
+// All the Functions return UNINASOC_ERROR in case of error and UNINASOC_OK otherwise
+
+// Initialize a queue over size slots (a power of two)
+int spsc_queue_init(spsc_queue_t* queue, void** slots, uint32_t size);
+
+// Returns UNINASOC_ERROR if the queue is full
+int spsc_queue_push(spsc_queue_t* queue, void* data);
+
+// Returns UNINASOC_ERROR if the queue is empty
+int spsc_queue_pop(spsc_queue_t* queue, void** data);
+
+// Number of queued items, as seen by the caller
+uint32_t spsc_queue_count(spsc_queue_t* queue);
+
+// Initialize a queue over size cells (a power of two)
+int mpsc_queue_init(mpsc_queue_t* queue, mpsc_cell_t* cells, uint32_t size);
+
+// Returns UNINASOC_ERROR if the queue is full
+int mpsc_queue_push(mpsc_queue_t* queue, void* data);
+
+// Returns UNINASOC_ERROR if the queue is empty, or if the oldest item is claimed
+// but not yet published (its producer was interrupted)
+int mpsc_queue_pop(mpsc_queue_t* queue, void** data);
+
+#endif
@@ -0,0 +1,91 @@
+// Description:
+//  This file defines the building blocks of the C++ HAL (uninasoc.hpp): memory-mapped
+//  registers and typed bitfields, both bound to their address at compile time.
+//  Every access is a single load or store with an immediate offset from a constant base,
+//  with no per-call checks: the address is validated by construction (generated memory map).
+//  Accessors are always inlined, also in the debug profile (-O0).
+//
+//  Example:
+//      using ctrl = reg<0x2000c>;
+//      using enable = field<ctrl, 4, 1, bool>;
+//      enable::write(true);                        // Read-modify-write of bit 4
+//      ctrl::write(enable::of(true) | 0x3);        // Single write of the whole register
+//
+//  Status bits cleared (or toggled) by writing 1 are declared in the W1C mask of the register:
+//  read-modify-writes (set_bits(), clear_bits(), field::write()) write them back as 0, so that
+//  they do not clear a pending status by accident.
+
+#ifndef REG_HPP
+#define REG_HPP
+
+#include <cstdint>
+
+#define UNINASOC_INLINE [[gnu::always_inline]] inline
+
+namespace uninasoc {
+
+// Register of type T at address Addr, with write-1-to-clear bits W1C
+template <uintptr_t Addr, typename T = uint32_t, T W1C = 0>
+struct reg {
+    using value_type = T;
+    static constexpr uintptr_t address = Addr;
+    static constexpr T w1c = W1C;
+
+    UNINASOC_INLINE static T read()
+    {
+        return *reinterpret_cast<volatile T*>(Addr);
+    }
+
+    UNINASOC_INLINE static void write(T value)
+    {
+        *reinterpret_cast<volatile T*>(Addr) = value;
+    }
+
+    // Read-modify-write, the W1C bits are written only if in mask (set_bits())
+    UNINASOC_INLINE static void set_bits(T mask)
+    {
+        write((read() & ~W1C) | mask);
+    }
+
+    UNINASOC_INLINE static void clear_bits(T mask)
+    {
+        write(read() & ~(mask | W1C));
+    }
+};
+
+// Bits [Offset, Offset + Width) of register Reg, read and written as V (e.g. bool or an enum)
+template <typename Reg, unsigned Offset, unsigned Width = 1, typename V = typename Reg::value_type>
+struct field {
+    using reg_type = typename Reg::value_type;
+
+    static_assert(Width > 0 && Offset + Width <= sizeof(reg_type) * 8, "field out of the register");
+
+    static constexpr reg_type mask =
+        (Width == sizeof(reg_type) * 8 ? ~reg_type(0) : ((reg_type(1) << Width) - 1)) << Offset;
+
+    // Field value in place, to compose whole register writes
+    UNINASOC_INLINE static constexpr reg_type of(V value)
+    {
+        return (static_cast<reg_type>(value) << Offset) & mask;
+    }
+
+    UNINASOC_INLINE static constexpr V extract(reg_type value)
+    {
+        return static_cast<V>((value & mask) >> Offset);
+    }
+
+    UNINASOC_INLINE static V read()
+    {
+        return extract(Reg::read());
+    }
+
+    // Read-modify-write, the other fields are preserved, W1C bits excepted
+    UNINASOC_INLINE static void write(V value)
+    {
+        Reg::write((Reg::read() & ~(mask | Reg::w1c)) | of(value));
+    }
+};
+
+} // namespace uninasoc
+
+#endif
@@ -0,0 +1,97 @@
+// Description:
+//  This file defines a cooperative scheduler for bare-metal applications.
+//  Tasks are stackful: each one runs on its own stack, provided by the caller, and gives the
+//  core back with sched_yield() or sched_sleep(). The context switch only saves the registers
+//  preserved across calls (ra, sp, s0-s11), so its cost does not depend on the task.
+//  Tasks are scheduled round-robin. When no task is runnable, sched_run() sleeps in wfi
+//  until an interrupt (e.g. the tick) makes one runnable again.
+//  The tick is a free-running counter advanced by TIM0 through the PLIC (PLIC_TIM0_INTERRUPT),
+//  or by calling sched_tick() from any other periodic source.
+//
+//  Note: tasks are never preempted, interrupt handlers must not call the scheduler
+//  except for sched_tick().
+//
+//  Example:
+//      uint8_t stack[1024] __attribute__((aligned(16)));
+//      task_t task;
+//
+//      void blink(void* arg)
+//      {
+//          while (1) {
+//              ...
+//              sched_sleep(10);
+//          }
+//      }
+//
+//      // In main()
+//      plic_init();
+//      plic_register_handler(PLIC_TIM0_INTERRUPT, sched_tick_handler, NULL, 1);
+//      sched_init();
+//      sched_create(&task, blink, NULL, stack, sizeof(stack));
+//      sched_start_tick(20000);    // One tick every 20000 timer cycles
+//      sched_run();                // Returns when all tasks have returned
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Task states
+#define TASK_READY      0
+#define TASK_SLEEPING   1
+#define TASK_EXITED     2
+
+typedef void (*task_entry_t)(void* arg);
+
+typedef struct task {
+    uintptr_t sp;               // Saved stack pointer, the context is on the stack
+    volatile uint32_t state;
+    uint32_t wake_tick;         // Valid while TASK_SLEEPING
+    task_entry_t entry;
+    void* arg;
+    uint32_t switches;          // Times the task was switched in
+    struct task* next;          // Circular list of tasks
+} task_t;
+
+// All the Functions return UNINASOC_ERROR in case of error and UNINASOC_OK otherwise
+
+// Reset the scheduler, with no tasks and the tick at 0
+int sched_init();
+
+// Add a task running entry(arg) on [stack, stack + stack_size). The task returns
+// (or exits) by returning from entry
+int sched_create(task_t* task, task_entry_t entry, void* arg, void* stack, size_t stack_size);
+
+// Run the tasks from the calling context, which becomes the idle context.
+// Returns when all the tasks have returned
+void sched_run();
+
+// Give the core to the next runnable task, returns when this task is scheduled again
+void sched_yield();
+
+// Sleep for the given number of ticks, or until the tick reaches the given value
+void sched_sleep(uint32_t ticks);
+void sched_sleep_until(uint32_t tick);
+
+// Running task, NULL in the idle context
+task_t* sched_current();
+
+// Current tick
+uint32_t sched_get_ticks();
+
+// Advance the tick, can be called from an interrupt handler
+void sched_tick();
+
+#ifdef TIM_IS_ENABLED
+// Start TIM0 with one tick every period timer clock cycles.
+// The PLIC must be configured separately, with
+// plic_register_handler(PLIC_TIM0_INTERRUPT, sched_tick_handler, NULL, 1)
+int sched_start_tick(uint32_t period);
+int sched_stop_tick();
+
+// Tick handler, acknowledges TIM0 and advances the tick
+void sched_tick_handler(void* arg);
+#endif
+
+#endif
@@ -0,0 +1,34 @@
+// Description:
+//  This file defines the placement macros for the hot and cold sections of the generated
+//  linker script (UninaSoC.ld):
+//      - Hot: boot memory (BRAM), single-cycle, for tight loops, ISRs and their data
+//      - Cold: largest other memory block (e.g. DDR, behind the clock converter and the
+//        system cache), for bulk code and data used once or rarely
+//  Code and data without a macro stay in the default sections, in the boot memory.
+//  Without a cold memory block (e.g. embedded), cold sections fall back to the boot memory.
+//
+//  Note: the cold section is not part of bin/<program>.bin, which only holds the boot memory.
+//  It is loaded with the ELF (e.g. make gdb_run), or from bin/<program>_cold.bin at the
+//  base of the cold memory block.
+//  Note: a section holds either writable or read-only data, const variables take the
+//  *_rodata macros.
+//  Note: BRAM and DDR usage is printed at every link (--print-memory-usage).
+//
+//  Example:
+//      __hot void my_isr(void* arg) { ... }
+//      __hot_data uint32_t samples[64];
+//      __cold_rodata const uint8_t lut[8192] = { ... };
+//      __cold void self_test() { ... }
+
+#ifndef SECTION_H
+#define SECTION_H
+
+#define __hot           __attribute__((section(".hot.text")))
+#define __hot_data      __attribute__((section(".hot.data")))
+#define __hot_rodata    __attribute__((section(".hot.rodata")))
+
+#define __cold          __attribute__((section(".cold.text"), cold))
+#define __cold_data     __attribute__((section(".cold.data")))
+#define __cold_rodata   __attribute__((section(".cold.rodata")))
+
+#endif
@@ -7,6 +7,19 @@
 
 void* memcpy(void* dest, const void* src, size_t n);
 
+void* memmove(void* dest, const void* src, size_t n);
+
 void* memset(void* dest, register int val, register size_t len);
 
+int memcmp(const void* s1, const void* s2, size_t n);
+
+// Allocation over the default heap (heap.h)
+void* malloc(size_t size);
+
+void* calloc(size_t num, size_t size);
+
+void* realloc(void* ptr, size_t size);
+
+void free(void* ptr);
+
 #endif // __STDLIB_H_
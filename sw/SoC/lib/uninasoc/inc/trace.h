@@ -0,0 +1,103 @@
+// Description:
+//  This file defines a deferred binary logging facility.
+//  TRACE("fmt", args...) does not format anything on the SoC: it stores a fixed-size record
+//  (format ID, mcycle timestamp, raw arguments) in the trace_buffer ring, overwriting the oldest.
+//  The format strings are placed in the .trace_fmt section, which the linker script keeps in the
+//  ELF but never loads (INFO section at address 0): the format ID is the string offset there.
+//  The host decoder (sw/host/trace) renders the records from a trace_dump() UART log, or from a
+//  raw readback of the trace_buffer symbol (e.g. over the XDMA BAR).
+//
+//  Arguments are stored as 32-bit words: up to TRACE_MAX_ARGS integers per record, pointers must be
+//  cast (uintptr_t), %s is not supported. The number of records is fixed when libuninasoc is built.
+//
+//  Example:
+//      trace_init();
+//      TRACE("conv done: %u outputs, status %d", num_outputs, status);
+//      ...
+//      trace_dump();
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include "perf.h"
+
+// Ring size, in records (must be a power of two)
+#ifndef TRACE_NUM_RECORDS
+#define TRACE_NUM_RECORDS   128
+#endif
+
+#define TRACE_MAX_ARGS      6
+
+// "TRC0", lets the host find the buffer in a raw readback
+#define TRACE_MAGIC         0x54524330
+
+// Record header: format ID (bits 23:0) and number of arguments (bits 31:24)
+#define TRACE_ID_MASK       0x00ffffff
+#define TRACE_NARGS_SHIFT   24
+
+// One record is 8 words
+typedef struct {
+    uint32_t header;
+    uint32_t timestamp;
+    uint32_t args[TRACE_MAX_ARGS];
+} trace_record_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t num_records;
+    volatile uint32_t head;     // Free-running, the next record is records[head % num_records]
+    uint32_t reserved;
+    trace_record_t records[TRACE_NUM_RECORDS];
+} trace_buffer_t;
+
+extern trace_buffer_t trace_buffer;
+
+// Reserve the next record. Interrupt handlers may trace too: only the increment
+// needs to be atomic, each caller then fills its own record
+static inline trace_record_t* trace_reserve()
+{
+    uint32_t head;
+#ifndef CORE_PICORV32
+    uintptr_t mstatus;
+    asm volatile("csrrc %0, mstatus, 0x8" : "=r"(mstatus));
+    head = trace_buffer.head++;
+    if (mstatus & 0x8) {
+        asm volatile("csrs mstatus, 0x8");
+    }
+#else
+    head = trace_buffer.head++;
+#endif
+    return &trace_buffer.records[head & (TRACE_NUM_RECORDS - 1)];
+}
+
+static inline void trace_emit(uintptr_t id, uint32_t nargs, const uint32_t* args)
+{
+    uint32_t timestamp = perf_cycles32();
+    trace_record_t* record = trace_reserve();
+
+    record->timestamp = timestamp;
+    for (uint32_t i = 0; i < nargs; i++) {
+        record->args[i] = args[i];
+    }
+    record->header = ((uint32_t)id & TRACE_ID_MASK) | (nargs << TRACE_NARGS_SHIFT);
+}
+
+// Log a record, the format string never reaches the SoC memory
+#define TRACE(fmt, ...)                                                                         \
+    do {                                                                                        \
+        static const char _trace_fmt[] __attribute__((section(".trace_fmt"), used)) = fmt;      \
+        const uint32_t _trace_args[] = { 0, ##__VA_ARGS__ };                                    \
+        _Static_assert(sizeof(_trace_args) / sizeof(uint32_t) - 1 <= TRACE_MAX_ARGS,            \
+                       "TRACE supports up to TRACE_MAX_ARGS arguments");                        \
+        trace_emit((uintptr_t)_trace_fmt, sizeof(_trace_args) / sizeof(uint32_t) - 1,          \
+                   &_trace_args[1]);                                                            \
+    } while (0)
+
+// Clear the ring
+void trace_init();
+
+// Print the ring on UART (oldest record first), between TRACE_BEGIN and TRACE_END lines
+void trace_dump();
+
+#endif
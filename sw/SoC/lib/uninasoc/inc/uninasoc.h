@@ -3,11 +3,19 @@
 
 #include "stdlib.h"
 
-// This header is autogenerated based on project configuration
+// These headers are autogenerated based on project configuration
 #include "uninasoc_conf.h"
+#include "uninasoc_map.h"
 
+#include "section.h"
 #include "irq_handlers.h"
 #include "plic.h"
+#include "arena.h"
+#include "heap.h"
+#include "perf.h"
+#include "trace.h"
+#include "atomic.h"
+#include "queue.h"
 
 #ifdef GPIO_IN_IS_ENABLED
 #include "xlnx_gpio_in.h"
@@ -17,8 +25,21 @@
 #include "xlnx_gpio_out.h"
 #endif
 
+#ifdef UART_IS_ENABLED
+#include "xlnx_uart.h"
+#endif
+
 #ifdef TIM_IS_ENABLED
 #include "xlnx_tim.h"
+#include "prof.h"
+#include "clock.h"
+#endif
+
+#include "sched.h"
+#include "xlnx_syscache.h"
+
+#ifdef HLS_CONTROL_IS_ENABLED
+#include "hls_conv.h"
 #endif
 
 #include "tinyIO.h"
@@ -30,10 +51,8 @@ enum{
 
 static inline void uninasoc_init()
 {
-    extern const volatile uintptr_t _peripheral_UART_start;
     // TinyIO init
-    uintptr_t uart_base_address = (uintptr_t)&_peripheral_UART_start;
-    tinyIO_init(uart_base_address);
+    tinyIO_init((uintptr_t)MAP_UART_BASEADDR);
 }
 
 #endif
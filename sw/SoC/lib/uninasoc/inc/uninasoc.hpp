@@ -0,0 +1,60 @@
+// Description:
+//  This file is the entry point of the optional C++17 header-only HAL.
+//  Peripheral types are templates on their base address, instantiated here with the
+//  addresses of the generated memory map (uninasoc_map.h), so register accesses compile
+//  to loads and stores with immediate offsets, without linker symbol loads or per-call checks.
+//  Register fields are typed bitfields (reg.hpp).
+//
+//  The C++ HAL does not depend on libuninasoc nor on any C++ runtime: C++ sources are built
+//  with -fno-exceptions -fno-rtti (see config.mk). Global objects with constructors are not
+//  supported, since the startup code does not run them.
+//
+//  Example:
+//      #include "uninasoc.hpp"
+//      using namespace uninasoc;
+//
+//      uart::init();
+//      uart::puts("Hello\r\n");
+//      gpio_out::write(gpio_in::read());
+//      tim0::configure(10000, true, true);
+//      tim0::start();
+
+#ifndef UNINASOC_HPP
+#define UNINASOC_HPP
+
+// These headers are autogenerated based on project configuration
+#include "uninasoc_conf.h"
+#include "uninasoc_map.h"
+
+#include "reg.hpp"
+#include "plic.hpp"
+#include "xlnx_uart.hpp"
+#include "xlnx_gpio.hpp"
+#include "xlnx_tim.hpp"
+
+namespace uninasoc {
+
+#ifdef PLIC_IS_ENABLED
+using plic = plic_ctrl<map::PLIC.base>;
+#endif
+
+#ifdef UART_IS_ENABLED
+using uart = xlnx_uart<map::UART.base>;
+#endif
+
+#ifdef GPIO_IN_IS_ENABLED
+using gpio_in = xlnx_gpio<map::GPIO_IN.base>;
+#endif
+
+#ifdef GPIO_OUT_IS_ENABLED
+using gpio_out = xlnx_gpio<map::GPIO_OUT.base>;
+#endif
+
+#ifdef TIM_IS_ENABLED
+using tim0 = xlnx_tim<map::TIM0.base>;
+using tim1 = xlnx_tim<map::TIM1.base>;
+#endif
+
+} // namespace uninasoc
+
+#endif
@@ -2,10 +2,19 @@
 #ifndef __UNINASOC_CONF_H__
 #define __UNINASOC_CONF_H__
 
+#define BRAM_IS_ENABLED 1
+#define DM_MEM_IS_ENABLED 1
+#define PLIC_IS_ENABLED 1
 #define UART_IS_ENABLED 1
 #define GPIO_OUT_IS_ENABLED 1
 #define GPIO_IN_IS_ENABLED 1
 #define TIM_IS_ENABLED 1
 #define TIM_IS_ENABLED 1
 
+#define MAIN_CLOCK_FREQ_MHZ 20
+#define BRAM_CLOCK_FREQ_MHZ 20
+#define DM_MEM_CLOCK_FREQ_MHZ 20
+#define PBUS_CLOCK_FREQ_MHZ 10
+#define PLIC_CLOCK_FREQ_MHZ 20
+
 #endif // __UNINASOC_CONF_H__
\ No newline at end of file
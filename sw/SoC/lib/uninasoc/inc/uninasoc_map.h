@@ -0,0 +1,61 @@
+// THIS FILE IS AUTOGENERATED, DON'T TOUCH!
+// Generated with create_uninasoc_map_header.py
+#ifndef __UNINASOC_MAP_H__
+#define __UNINASOC_MAP_H__
+
+// MBUS
+#define MAP_BRAM_BASEADDR 0x0
+#define MAP_BRAM_SIZE 0x10000
+#define MAP_BRAM_CLOCK_FREQ_MHZ 20
+#define MAP_DM_MEM_BASEADDR 0x10000
+#define MAP_DM_MEM_SIZE 0x10000
+#define MAP_DM_MEM_CLOCK_FREQ_MHZ 20
+#define MAP_PBUS_BASEADDR 0x20000
+#define MAP_PBUS_SIZE 0x10000
+#define MAP_PBUS_CLOCK_FREQ_MHZ 10
+#define MAP_PLIC_BASEADDR 0x4000000
+#define MAP_PLIC_SIZE 0x4000000
+#define MAP_PLIC_CLOCK_FREQ_MHZ 20
+// PBUS
+#define MAP_UART_BASEADDR 0x20000
+#define MAP_UART_SIZE 0x10
+#define MAP_UART_CLOCK_FREQ_MHZ 10
+#define MAP_GPIO_OUT_BASEADDR 0x20200
+#define MAP_GPIO_OUT_SIZE 0x200
+#define MAP_GPIO_OUT_CLOCK_FREQ_MHZ 10
+#define MAP_GPIO_IN_BASEADDR 0x20400
+#define MAP_GPIO_IN_SIZE 0x200
+#define MAP_GPIO_IN_CLOCK_FREQ_MHZ 10
+#define MAP_TIM0_BASEADDR 0x20600
+#define MAP_TIM0_SIZE 0x20
+#define MAP_TIM0_CLOCK_FREQ_MHZ 10
+#define MAP_TIM1_BASEADDR 0x20620
+#define MAP_TIM1_SIZE 0x20
+#define MAP_TIM1_CLOCK_FREQ_MHZ 10
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+
+namespace uninasoc::map {
+
+struct range {
+    uintptr_t base;
+    size_t size;
+    unsigned clock_freq_mhz;
+};
+
+inline constexpr range BRAM = { MAP_BRAM_BASEADDR, MAP_BRAM_SIZE, MAP_BRAM_CLOCK_FREQ_MHZ };
+inline constexpr range DM_MEM = { MAP_DM_MEM_BASEADDR, MAP_DM_MEM_SIZE, MAP_DM_MEM_CLOCK_FREQ_MHZ };
+inline constexpr range PBUS = { MAP_PBUS_BASEADDR, MAP_PBUS_SIZE, MAP_PBUS_CLOCK_FREQ_MHZ };
+inline constexpr range PLIC = { MAP_PLIC_BASEADDR, MAP_PLIC_SIZE, MAP_PLIC_CLOCK_FREQ_MHZ };
+inline constexpr range UART = { MAP_UART_BASEADDR, MAP_UART_SIZE, MAP_UART_CLOCK_FREQ_MHZ };
+inline constexpr range GPIO_OUT = { MAP_GPIO_OUT_BASEADDR, MAP_GPIO_OUT_SIZE, MAP_GPIO_OUT_CLOCK_FREQ_MHZ };
+inline constexpr range GPIO_IN = { MAP_GPIO_IN_BASEADDR, MAP_GPIO_IN_SIZE, MAP_GPIO_IN_CLOCK_FREQ_MHZ };
+inline constexpr range TIM0 = { MAP_TIM0_BASEADDR, MAP_TIM0_SIZE, MAP_TIM0_CLOCK_FREQ_MHZ };
+inline constexpr range TIM1 = { MAP_TIM1_BASEADDR, MAP_TIM1_SIZE, MAP_TIM1_CLOCK_FREQ_MHZ };
+
+} // namespace uninasoc::map
+#endif // __cplusplus
+
+#endif // __UNINASOC_MAP_H__
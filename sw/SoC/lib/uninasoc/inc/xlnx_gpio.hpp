@@ -0,0 +1,58 @@
+// Description:
+//  This file defines the C++ HAL of the AXI GPIO (first channel), for both the input and the
+//  output instances, see xlnx_gpio_in.h and xlnx_gpio_out.h for the C drivers.
+
+#ifndef XLNX_GPIO_HPP
+#define XLNX_GPIO_HPP
+
+#include "reg.hpp"
+
+// https://docs.amd.com/v/u/en-US/pg144-axi-gpio
+
+namespace uninasoc {
+
+template <uintptr_t Base>
+struct xlnx_gpio {
+    // Registers
+    using data = reg<Base + 0x0000>;
+    using tri = reg<Base + 0x0004>;         // 1 for input, 0 for output
+    using gier = reg<Base + 0x011C>;
+    using isr = reg<Base + 0x0120, uint32_t, 0x3>;  // Toggle-on-write, both channels
+    using ier = reg<Base + 0x0128>;
+
+    using gier_enable = field<gier, 31, 1, bool>;
+    using isr_channel1 = field<isr, 0, 1, bool>;
+    using ier_channel1 = field<ier, 0, 1, bool>;
+
+    UNINASOC_INLINE static uint32_t read()
+    {
+        return data::read();
+    }
+
+    UNINASOC_INLINE static void write(uint32_t value)
+    {
+        data::write(value);
+    }
+
+    UNINASOC_INLINE static void toggle(uint32_t mask)
+    {
+        data::write(data::read() ^ mask);
+    }
+
+    // Interrupt on any change of the channel
+    UNINASOC_INLINE static void enable_interrupt()
+    {
+        ier::write(ier_channel1::of(true));
+        gier::write(gier_enable::of(true));
+    }
+
+    // To be called from the interrupt handler, before the PLIC completion
+    UNINASOC_INLINE static void clear_interrupt()
+    {
+        isr::write(isr_channel1::of(true));
+    }
+};
+
+} // namespace uninasoc
+
+#endif
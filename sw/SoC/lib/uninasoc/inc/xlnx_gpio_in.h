@@ -8,13 +8,12 @@
 #define XLNX_GPIO_IN_H
 
 #include <stdint.h>
+#include "uninasoc_map.h"
 
 // https://docs.amd.com/v/u/en-US/pg144-axi-gpio
 
-// Import linker script symbol
-extern const volatile uint32_t _peripheral_GPIO_in_start;
-
-#define GPIO_IN_BASEADDR ((uintptr_t)&_peripheral_GPIO_in_start)
+// Base address (generated memory map)
+#define GPIO_IN_BASEADDR ((uintptr_t)MAP_GPIO_IN_BASEADDR)
 
 // INTERRUPTS
 typedef enum {
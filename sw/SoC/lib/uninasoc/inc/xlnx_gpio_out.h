@@ -8,16 +8,14 @@
 #define XLNX_GPIO_OUT_H
 
 #include <stdint.h>
+#include "uninasoc_map.h"
 
 // https://docs.amd.com/v/u/en-US/pg144-axi-gpio
 
-// Import linker script symbol
-extern const volatile uint32_t _peripheral_GPIO_out_start;
-
 // GPIO is configured to use just one channel (so all the "2" registers like GPIO2_DATA are unused)
 
-// Base address
-#define GPIO_OUT_BASEADDR ((uintptr_t)&_peripheral_GPIO_out_start)
+// Base address (generated memory map)
+#define GPIO_OUT_BASEADDR ((uintptr_t)MAP_GPIO_OUT_BASEADDR)
 
 // The GPIO OUT peripheral has 16 output pins
 // every bit in the "DATA" register controls the output of each pins
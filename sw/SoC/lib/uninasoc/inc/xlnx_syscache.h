@@ -0,0 +1,68 @@
+// Description:
+//  This file defines the API to operate the AXI System Cache in front of DDR4CH1, through its
+//  control interface (CACHE_CTRL on the MBUS): cache maintenance by address range and
+//  hit/miss statistics.
+//  The core and the HLS accelerators (HBUS, bridged to the MBUS) share the cache in front of
+//  DDR4CH1, so their buffers need no maintenance. Flush and invalidate are for the agents that
+//  reach the memory without crossing the cache, and to start a measurement from a cold cache.
+//  Every operation is complete on return.
+//  Statistics count the accesses of the MBUS port since the last reset, so that firmware can
+//  measure the cache effectiveness of a workload:
+//      xlnx_syscache_stats_reset();
+//      workload();
+//      xlnx_syscache_stats_read(&stats);
+//  Without the control interface (e.g. embedded profile) the maintenance functions are no-ops
+//  and the statistics functions return UNINASOC_ERROR.
+
+#ifndef XLNX_SYSCACHE_H
+#define XLNX_SYSCACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "uninasoc_map.h"
+
+// https://docs.amd.com/r/en-US/pg118_system_cache
+
+// Access counters of the MBUS port
+typedef struct {
+    uint64_t read_hits;
+    uint64_t read_misses;
+    uint64_t write_hits;
+    uint64_t write_misses;
+    uint64_t evictions;             // Misses that wrote back a dirty line
+} xlnx_syscache_stats_t;
+
+#ifdef CACHE_CTRL_IS_ENABLED
+
+// Base address (generated memory map)
+#define SYSCACHE_BASEADDR ((uintptr_t)MAP_CACHE_CTRL_BASEADDR)
+
+// Cacheable range (C_BASEADDR, C_HIGHADDR)
+#define SYSCACHE_CACHED_BASEADDR ((uintptr_t)MAP_DDR4CH1_BASEADDR)
+#define SYSCACHE_CACHED_ENDADDR  ((uintptr_t)(MAP_DDR4CH1_BASEADDR + MAP_DDR4CH1_SIZE))
+
+// Cache line length in bytes, generated in uninasoc_conf.h from the CACHE_LINE_LENGTH
+// property (in 32-bit words) of the MBUS configuration
+#ifndef SYSCACHE_LINE_SIZE
+#define SYSCACHE_LINE_SIZE 128
+#endif
+
+#endif
+
+// All the Functions return UNINASOC_ERROR in case of error and UNINASOC_OK otherwise
+
+// Write back the dirty lines of [addr, addr + size) and invalidate them.
+// Addresses outside the cacheable range are skipped
+int xlnx_syscache_flush_range(uintptr_t addr, size_t size);
+
+// Invalidate the lines of [addr, addr + size), dropping their content.
+// Partially covered lines at the edges are flushed instead, preserving the neighbouring data
+int xlnx_syscache_invalidate_range(uintptr_t addr, size_t size);
+
+// Clear all the statistics counters and (re)start counting
+int xlnx_syscache_stats_reset();
+
+// Read the statistics counters
+int xlnx_syscache_stats_read(xlnx_syscache_stats_t* stats);
+
+#endif
@@ -8,16 +8,13 @@
 #define TIM_H
 
 #include <stdint.h>
+#include "uninasoc_map.h"
 
 // https://docs.amd.com/v/u/en-US/pg079-axi-timer
 
-// Import linker script symbols
-extern const volatile uint32_t _peripheral_TIM0_start;
-extern const volatile uint32_t _peripheral_TIM1_start;
-
-// Base address
-#define TIM0_BASEADDR ((uintptr_t)&_peripheral_TIM0_start)
-#define TIM1_BASEADDR ((uintptr_t)&_peripheral_TIM1_start)
+// Base address (generated memory map)
+#define TIM0_BASEADDR ((uintptr_t)MAP_TIM0_BASEADDR)
+#define TIM1_BASEADDR ((uintptr_t)MAP_TIM1_BASEADDR)
 
 
 // The timer keeps reloading the initial counter value
@@ -60,4 +57,18 @@ int xlnx_tim_clear_int(xlnx_tim_t* timer);
 // This function starts the timer
 int xlnx_tim_start(xlnx_tim_t* timer);
 
+// This function stops the timer, the counter value is held
+int xlnx_tim_stop(xlnx_tim_t* timer);
+
+// This function returns the current counter value (TCR)
+uint32_t xlnx_tim_get_value(xlnx_tim_t* timer);
+
+// Configure both counters of the instance in cascade mode, as a single 64-bit counter
+// counting up from 0 (counter and mode parameters are ignored).
+// Start and stop it with xlnx_tim_start() and xlnx_tim_stop()
+int xlnx_tim_configure_cascade(xlnx_tim_t* timer);
+
+// This function returns the current value of the cascaded counter
+uint64_t xlnx_tim_get_value64(xlnx_tim_t* timer);
+
 #endif
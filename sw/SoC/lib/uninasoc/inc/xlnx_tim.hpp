@@ -0,0 +1,97 @@
+// Description:
+//  This file defines the C++ HAL of the AXI Timer, both counters, see xlnx_tim.h for the C
+//  driver and clock.h for the 64-bit clocksource.
+
+#ifndef XLNX_TIM_HPP
+#define XLNX_TIM_HPP
+
+#include "reg.hpp"
+
+// https://docs.amd.com/v/u/en-US/pg079-axi-timer
+
+namespace uninasoc {
+
+template <uintptr_t Base>
+struct xlnx_tim {
+    // TINT (bit 8) is cleared by writing 1, see reg
+    static constexpr uint32_t tcsr_w1c = uint32_t(1) << 8;
+
+    // Registers, counter 0 and counter 1
+    using tcsr0 = reg<Base + 0x00, uint32_t, tcsr_w1c>;
+    using tlr0 = reg<Base + 0x04>;
+    using tcr0 = reg<Base + 0x08>;
+    using tcsr1 = reg<Base + 0x10, uint32_t, tcsr_w1c>;
+    using tlr1 = reg<Base + 0x14>;
+    using tcr1 = reg<Base + 0x18>;
+
+    // Control and status fields (same layout in TCSR1, CASC excluded)
+    using tcsr0_count_down = field<tcsr0, 1, 1, bool>;      // UDT
+    using tcsr0_auto_reload = field<tcsr0, 4, 1, bool>;     // ARHT
+    using tcsr0_load = field<tcsr0, 5, 1, bool>;
+    using tcsr0_enable_int = field<tcsr0, 6, 1, bool>;      // ENIT
+    using tcsr0_enable = field<tcsr0, 7, 1, bool>;          // ENT
+    using tcsr0_int = field<tcsr0, 8, 1, bool>;             // TINT, toggle-on-write
+    using tcsr0_cascade = field<tcsr0, 11, 1, bool>;        // CASC
+    using tcsr1_load = field<tcsr1, 5, 1, bool>;
+
+    // Load the counter, stopped
+    UNINASOC_INLINE static void configure(uint32_t counter, bool count_down, bool auto_reload)
+    {
+        tlr0::write(counter);
+        tcsr0::write(tcsr0_count_down::of(count_down) | tcsr0_auto_reload::of(auto_reload) | tcsr0_load::of(true));
+    }
+
+    // Both counters as one 64-bit counter counting up from 0, stopped
+    UNINASOC_INLINE static void configure_cascade()
+    {
+        tcsr0::write(0);
+        tcsr1::write(0);
+        tlr0::write(0);
+        tlr1::write(0);
+        tcsr1::write(tcsr1_load::of(true));
+        tcsr1::write(0);
+        tcsr0::write(tcsr0_cascade::of(true) | tcsr0_auto_reload::of(true) | tcsr0_load::of(true));
+    }
+
+    UNINASOC_INLINE static void start()
+    {
+        // LOAD must be low for the counter to run
+        tcsr0::write((tcsr0::read() & ~(tcsr0_load::mask | tcsr0::w1c)) | tcsr0_enable::mask);
+    }
+
+    UNINASOC_INLINE static void stop()
+    {
+        tcsr0_enable::write(false);
+    }
+
+    UNINASOC_INLINE static void enable_interrupt()
+    {
+        tcsr0_enable_int::write(true);
+    }
+
+    UNINASOC_INLINE static void clear_interrupt()
+    {
+        tcsr0::set_bits(tcsr0_int::mask);
+    }
+
+    UNINASOC_INLINE static uint32_t value()
+    {
+        return tcr0::read();
+    }
+
+    // Cascaded value, the high half is re-read to detect a carry from the low half
+    UNINASOC_INLINE static uint64_t value64()
+    {
+        uint32_t high;
+        uint32_t low;
+        do {
+            high = tcr1::read();
+            low = tcr0::read();
+        } while (high != tcr1::read());
+        return (static_cast<uint64_t>(high) << 32) | low;
+    }
+};
+
+} // namespace uninasoc
+
+#endif
@@ -0,0 +1,77 @@
+// Description:
+//  This file defines the API to adoperate the UART (AXI UART Lite on embedded, virtual UART on HPC,
+//  both with the PG142 register map) through TX and RX ring buffers.
+//  Writes only copy into the TX ring: the UART interrupt (PLIC_UART_INTERRUPT) moves the data
+//  into the TX FIFO when it drains, and moves received bytes into the RX ring.
+//
+//  Note: the virtual UART does not raise the core interrupt yet. On HPC, xlnx_uart_poll() must
+//  be called periodically (or xlnx_uart_flush() before waiting for input).
+//  Note: TinyIO printf() writes the TX register directly, call xlnx_uart_flush() before mixing them.
+
+#ifndef XLNX_UART_H
+#define XLNX_UART_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "uninasoc_map.h"
+
+// https://docs.amd.com/v/u/en-US/pg142-axi-uartlite
+
+// Base address (generated memory map)
+#define UART_BASEADDR ((uintptr_t)MAP_UART_BASEADDR)
+
+// Ring buffer sizes (must be powers of two)
+#ifndef UART_TX_BUFFER_SIZE
+#define UART_TX_BUFFER_SIZE 1024
+#endif
+
+#ifndef UART_RX_BUFFER_SIZE
+#define UART_RX_BUFFER_SIZE 128
+#endif
+
+// Need to be initialized with UART_BASEADDR
+typedef struct {
+    uintptr_t base_addr;
+    // TX ring, written by the core, drained by the interrupt handler
+    uint8_t tx_buffer[UART_TX_BUFFER_SIZE];
+    volatile uint32_t tx_head;
+    volatile uint32_t tx_tail;
+    volatile uint32_t tx_busy;      // Bytes are in flight, the TX-empty interrupt will follow
+    // RX ring, written by the interrupt handler, drained by the core
+    uint8_t rx_buffer[UART_RX_BUFFER_SIZE];
+    volatile uint32_t rx_head;
+    volatile uint32_t rx_tail;
+    volatile uint32_t rx_dropped;   // Bytes lost because the RX ring was full
+} xlnx_uart_t;
+
+// All the Functions return UNINASOC_ERROR in case of error and UNINASOC_OK otherwise
+
+// Reset the FIFOs and the rings, and enable the UART interrupt.
+// The PLIC must be configured separately, e.g. with
+// plic_register_handler(PLIC_UART_INTERRUPT, <handler calling xlnx_uart_irq_handler>, uart, 1)
+int xlnx_uart_init(xlnx_uart_t* uart);
+
+// Copy up to len bytes into the TX ring without blocking, returns the number of bytes queued
+size_t xlnx_uart_write(xlnx_uart_t* uart, const void* data, size_t len);
+
+// Queue a character or a string, waiting for space in the TX ring if needed
+void xlnx_uart_putc(xlnx_uart_t* uart, char c);
+void xlnx_uart_puts(xlnx_uart_t* uart, const char* str);
+
+// Copy up to len received bytes without blocking, returns the number of bytes read
+size_t xlnx_uart_read(xlnx_uart_t* uart, void* data, size_t len);
+
+// Returns the next received character, or -1 if the RX ring is empty
+int xlnx_uart_getc(xlnx_uart_t* uart);
+
+// Wait until the TX ring and the TX FIFO are empty
+void xlnx_uart_flush(xlnx_uart_t* uart);
+
+// Service the UART without interrupts: fill the TX FIFO and drain the RX FIFO
+void xlnx_uart_poll(xlnx_uart_t* uart);
+
+// Interrupt handler, to be called when the claimed source is PLIC_UART_INTERRUPT.
+// The PLIC claim/complete is left to the caller
+void xlnx_uart_irq_handler(xlnx_uart_t* uart);
+
+#endif
@@ -0,0 +1,82 @@
+// Description:
+//  This file defines the C++ HAL of the AXI UART Lite (polling), see xlnx_uart.h for the
+//  interrupt-driven C driver.
+
+#ifndef XLNX_UART_HPP
+#define XLNX_UART_HPP
+
+#include "reg.hpp"
+
+// https://docs.amd.com/v/u/en-US/pg142-axi-uartlite
+
+namespace uninasoc {
+
+template <uintptr_t Base>
+struct xlnx_uart {
+    // Registers
+    using rx_fifo = reg<Base + 0x00>;
+    using tx_fifo = reg<Base + 0x04>;
+    using stat = reg<Base + 0x08>;
+    using ctrl = reg<Base + 0x0C>;
+
+    // Status register fields
+    using stat_rx_valid = field<stat, 0, 1, bool>;
+    using stat_rx_full = field<stat, 1, 1, bool>;
+    using stat_tx_empty = field<stat, 2, 1, bool>;
+    using stat_tx_full = field<stat, 3, 1, bool>;
+    using stat_intr_enabled = field<stat, 4, 1, bool>;
+    using stat_overrun_error = field<stat, 5, 1, bool>;
+    using stat_frame_error = field<stat, 6, 1, bool>;
+    using stat_parity_error = field<stat, 7, 1, bool>;
+
+    // Control register fields (write-only register)
+    using ctrl_rst_tx = field<ctrl, 0, 1, bool>;
+    using ctrl_rst_rx = field<ctrl, 1, 1, bool>;
+    using ctrl_enable_intr = field<ctrl, 4, 1, bool>;
+
+    // Reset the FIFOs, with the interrupt enabled or not
+    UNINASOC_INLINE static void init(bool enable_intr = false)
+    {
+        ctrl::write(ctrl_rst_tx::of(true) | ctrl_rst_rx::of(true) | ctrl_enable_intr::of(enable_intr));
+    }
+
+    UNINASOC_INLINE static void putc(char c)
+    {
+        while (stat_tx_full::read());
+        tx_fifo::write(static_cast<uint8_t>(c));
+    }
+
+    static void puts(const char* str)
+    {
+        while (*str) {
+            putc(*str++);
+        }
+    }
+
+    // Blocking read
+    UNINASOC_INLINE static char getc()
+    {
+        while (!stat_rx_valid::read());
+        return static_cast<char>(rx_fifo::read());
+    }
+
+    // Non-blocking read, returns false if no data is available
+    UNINASOC_INLINE static bool try_getc(char& c)
+    {
+        if (!stat_rx_valid::read()) {
+            return false;
+        }
+        c = static_cast<char>(rx_fifo::read());
+        return true;
+    }
+
+    // Wait until the TX FIFO is empty
+    UNINASOC_INLINE static void flush()
+    {
+        while (!stat_tx_empty::read());
+    }
+};
+
+} // namespace uninasoc
+
+#endif
@@ -0,0 +1,128 @@
+// Description:
+//  This file implements the arena and pool allocators
+
+#include "uninasoc.h"
+#include "arena.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Align up x to align (a power of two)
+#define ALIGN_UP(x, align) (((x) + ((align) - 1)) & ~((uintptr_t)(align) - 1))
+
+static inline int is_power_of_two(size_t x)
+{
+    return (x != 0) && ((x & (x - 1)) == 0);
+}
+
+int arena_init(arena_t* arena, uintptr_t base, size_t size)
+{
+    if (size == 0 || base + size < base) {
+        return UNINASOC_ERROR;
+    }
+
+    arena->base = base;
+    arena->end = base + size;
+    arena->top = base;
+    return UNINASOC_OK;
+}
+
+void* arena_alloc(arena_t* arena, size_t size, size_t align)
+{
+    if (!is_power_of_two(align)) {
+        return NULL;
+    }
+
+    uintptr_t start = ALIGN_UP(arena->top, align);
+
+    // Check for overflows and out-of-memory
+    if (start < arena->top || start + size < start || start + size > arena->end) {
+        return NULL;
+    }
+
+    arena->top = start + size;
+    return (void*)start;
+}
+
+void arena_reset(arena_t* arena)
+{
+    arena->top = arena->base;
+}
+
+uintptr_t arena_mark(arena_t* arena)
+{
+    return arena->top;
+}
+
+int arena_release(arena_t* arena, uintptr_t mark)
+{
+    if (mark < arena->base || mark > arena->top) {
+        return UNINASOC_ERROR;
+    }
+
+    arena->top = mark;
+    return UNINASOC_OK;
+}
+
+size_t arena_available(arena_t* arena)
+{
+    return arena->end - arena->top;
+}
+
+int pool_init(pool_t* pool, arena_t* arena, size_t block_size, size_t num_blocks, size_t align)
+{
+    // Each free block stores the pointer to the next one
+    if (align < sizeof(void*)) {
+        align = sizeof(void*);
+    }
+    if (block_size < sizeof(void*)) {
+        block_size = sizeof(void*);
+    }
+    if (!is_power_of_two(align) || num_blocks == 0) {
+        return UNINASOC_ERROR;
+    }
+
+    // Keep every block aligned
+    block_size = ALIGN_UP(block_size, align);
+
+    uint8_t* blocks = (uint8_t*)arena_alloc(arena, block_size * num_blocks, align);
+    if (blocks == NULL) {
+        return UNINASOC_ERROR;
+    }
+
+    // Thread the free list through the blocks, in address order
+    pool->free_list = NULL;
+    for (size_t i = num_blocks; i > 0; i--) {
+        void** block = (void**)(blocks + (i - 1) * block_size);
+        *block = pool->free_list;
+        pool->free_list = block;
+    }
+
+    pool->block_size = block_size;
+    pool->num_blocks = num_blocks;
+    pool->free_blocks = num_blocks;
+    return UNINASOC_OK;
+}
+
+void* pool_alloc(pool_t* pool)
+{
+    void** block = (void**)pool->free_list;
+    if (block == NULL) {
+        return NULL;
+    }
+
+    pool->free_list = *block;
+    pool->free_blocks--;
+    return (void*)block;
+}
+
+void pool_free(pool_t* pool, void* block)
+{
+    if (block == NULL) {
+        return;
+    }
+
+    *(void**)block = pool->free_list;
+    pool->free_list = block;
+    pool->free_blocks++;
+}
@@ -0,0 +1,27 @@
+// Description:
+//  This file implements the 64-bit clocksource (see clock.h)
+
+#include "uninasoc.h"
+
+#ifdef TIM_IS_ENABLED
+
+#include <stdint.h>
+
+static xlnx_tim_t clock_timer = {
+    .base_addr = CLOCK_BASEADDR
+};
+
+int clock_init()
+{
+    if (xlnx_tim_configure_cascade(&clock_timer) != UNINASOC_OK) {
+        return UNINASOC_ERROR;
+    }
+    return xlnx_tim_start(&clock_timer);
+}
+
+uint64_t clock_ticks()
+{
+    return xlnx_tim_get_value64(&clock_timer);
+}
+
+#endif
@@ -0,0 +1,82 @@
+// Description:
+//  64-bit division helpers for RV32. Applications are linked with -nostdlib and without
+//  libgcc, so any 64-bit division or modulo (e.g. averaging mcycle values) would leave
+//  __udivdi3 and friends undefined. This object is only pulled in from libuninasoc.a
+//  when they are referenced.
+
+#include <stdint.h>
+
+#if __riscv_xlen == 32
+
+// Restoring shift-subtract division, 64 iterations at most
+static uint64_t udivmod64(uint64_t dividend, uint64_t divisor, uint64_t* remainder)
+{
+    uint64_t quotient = 0;
+    uint64_t rem = 0;
+
+    if (divisor == 0) {
+        // Match the RISC-V M extension: all ones quotient, dividend as remainder
+        *remainder = dividend;
+        return ~(uint64_t)0;
+    }
+
+    for (int i = 63; i >= 0; i--) {
+        rem = (rem << 1) | ((dividend >> i) & 1);
+        if (rem >= divisor) {
+            rem -= divisor;
+            quotient |= (uint64_t)1 << i;
+        }
+    }
+
+    *remainder = rem;
+    return quotient;
+}
+
+uint64_t __udivdi3(uint64_t a, uint64_t b)
+{
+    uint64_t rem;
+    return udivmod64(a, b, &rem);
+}
+
+uint64_t __umoddi3(uint64_t a, uint64_t b)
+{
+    uint64_t rem;
+    udivmod64(a, b, &rem);
+    return rem;
+}
+
+// Signed variants divide the magnitudes. -(uint64_t)x is the magnitude of any negative x,
+// INT64_MIN included (2^63, representable unsigned); converting back to int64_t wraps
+// (GCC), so INT64_MIN / -1 gives INT64_MIN and INT64_MIN % -1 gives 0, as DIV/REM do.
+
+int64_t __divdi3(int64_t a, int64_t b)
+{
+    uint64_t rem;
+
+    // Match DIV: -1, before the sign fixup would negate the all ones quotient
+    if (b == 0) {
+        return -1;
+    }
+
+    uint64_t ua = a < 0 ? -(uint64_t)a : (uint64_t)a;
+    uint64_t ub = b < 0 ? -(uint64_t)b : (uint64_t)b;
+    uint64_t q = udivmod64(ua, ub, &rem);
+    return (int64_t)(((a < 0) != (b < 0)) ? -q : q);
+}
+
+int64_t __moddi3(int64_t a, int64_t b)
+{
+    uint64_t rem;
+
+    // Match REM: the dividend
+    if (b == 0) {
+        return a;
+    }
+
+    uint64_t ua = a < 0 ? -(uint64_t)a : (uint64_t)a;
+    uint64_t ub = b < 0 ? -(uint64_t)b : (uint64_t)b;
+    udivmod64(ua, ub, &rem);
+    return (int64_t)(a < 0 ? -rem : rem);
+}
+
+#endif
@@ -0,0 +1,390 @@
+// Description:
+//  This file implements the segregated-fit heap (see heap.h) and the stdlib allocation
+//  functions over the default heap.
+//
+//  Block layout (sizes are multiples of HEAP_ALIGN and include the header):
+//      used: | size + flags | payload ...                         |
+//      free: | size + flags | next | prev | ...          | size   |
+//  The payload follows a one-word header and is HEAP_ALIGN-aligned. Free blocks repeat their
+//  size in the last word (footer), so that the next block can find them when coalescing.
+//  A zero-sized used block marks the end of the heap.
+
+#include "uninasoc.h"
+#include <stdint.h>
+#include <stddef.h>
+
+struct heap_block {
+    size_t size;            // Block size and flags
+    heap_block_t* next;     // Free blocks only
+    heap_block_t* prev;     // Free blocks only
+};
+
+#define HEAP_HEADER_SIZE    sizeof(size_t)
+#define HEAP_MIN_BLOCK      (2 * HEAP_ALIGN)    // Header, links and footer
+
+// Flags in the low bits of the size
+#define HEAP_USED           ((size_t)1 << 0)
+#define HEAP_PREV_USED      ((size_t)1 << 1)
+#define HEAP_FLAGS          (HEAP_USED | HEAP_PREV_USED)
+
+heap_t uninasoc_heap;
+static int uninasoc_heap_ready = 0;
+
+static inline size_t heap_block_size(heap_block_t* block)
+{
+    return block->size & ~HEAP_FLAGS;
+}
+
+static inline heap_block_t* heap_next_block(heap_block_t* block)
+{
+    return (heap_block_t*)((uintptr_t)block + heap_block_size(block));
+}
+
+static inline void* heap_payload(heap_block_t* block)
+{
+    return (void*)((uintptr_t)block + HEAP_HEADER_SIZE);
+}
+
+static inline heap_block_t* heap_header(void* ptr)
+{
+    return (heap_block_t*)((uintptr_t)ptr - HEAP_HEADER_SIZE);
+}
+
+// floor(log2(size))
+static inline uint32_t heap_bin_floor(size_t size)
+{
+    uint32_t bin = 0;
+    while (size >>= 1) {
+        bin++;
+    }
+    return bin;
+}
+
+// ceil(log2(size)), every block in this bin or above fits size
+static inline uint32_t heap_bin_ceil(size_t size)
+{
+    uint32_t bin = heap_bin_floor(size);
+    return ((size_t)1 << bin) == size ? bin : bin + 1;
+}
+
+static void heap_insert(heap_t* heap, heap_block_t* block)
+{
+    size_t size = heap_block_size(block);
+    uint32_t bin = heap_bin_floor(size);
+
+    // Footer
+    *(size_t*)((uintptr_t)block + size - sizeof(size_t)) = size;
+
+    block->prev = NULL;
+    block->next = heap->bins[bin];
+    if (block->next != NULL) {
+        block->next->prev = block;
+    }
+    heap->bins[bin] = block;
+    heap->bitmap |= (uintptr_t)1 << bin;
+}
+
+static void heap_remove(heap_t* heap, heap_block_t* block)
+{
+    uint32_t bin = heap_bin_floor(heap_block_size(block));
+
+    if (block->prev != NULL) {
+        block->prev->next = block->next;
+    } else {
+        heap->bins[bin] = block->next;
+    }
+    if (block->next != NULL) {
+        block->next->prev = block->prev;
+    }
+    if (heap->bins[bin] == NULL) {
+        heap->bitmap &= ~((uintptr_t)1 << bin);
+    }
+}
+
+// Find a free block of at least size bytes
+static heap_block_t* heap_find(heap_t* heap, size_t size)
+{
+    uint32_t bin = heap_bin_ceil(size);
+
+    // Good fit: the first block of any bin above fits, bounded cost
+    for (uint32_t i = bin; i < HEAP_NUM_BINS; i++) {
+        if (heap->bitmap & ((uintptr_t)1 << i)) {
+            return heap->bins[i];
+        }
+    }
+
+    // Last resort: blocks in the bin of size may still fit
+    bin = heap_bin_floor(size);
+    for (heap_block_t* block = heap->bins[bin]; block != NULL; block = block->next) {
+        if (heap_block_size(block) >= size) {
+            return block;
+        }
+    }
+
+    return NULL;
+}
+
+int heap_init(heap_t* heap, uintptr_t base, size_t size)
+{
+    uintptr_t start;
+    uintptr_t end;
+
+    if (base + size < base) {
+        return UNINASOC_ERROR;
+    }
+
+    // Headers sit one word before a HEAP_ALIGN boundary, leave room for the end sentinel
+    start = ((base + HEAP_HEADER_SIZE + HEAP_ALIGN - 1) & ~(HEAP_ALIGN - 1)) - HEAP_HEADER_SIZE;
+    if (base + size < start + HEAP_HEADER_SIZE + HEAP_MIN_BLOCK) {
+        return UNINASOC_ERROR;
+    }
+    end = start + ((base + size - HEAP_HEADER_SIZE - start) & ~(HEAP_ALIGN - 1));
+
+    for (uint32_t i = 0; i < HEAP_NUM_BINS; i++) {
+        heap->bins[i] = NULL;
+    }
+    heap->bitmap = 0;
+    heap->base = start;
+    heap->end = end;
+    heap->used = 0;
+    heap->peak = 0;
+
+    // One free block spanning the whole heap, then the sentinel
+    ((heap_block_t*)start)->size = (end - start) | HEAP_PREV_USED;
+    heap_insert(heap, (heap_block_t*)start);
+    ((heap_block_t*)end)->size = HEAP_USED;
+
+    return UNINASOC_OK;
+}
+
+void* heap_alloc(heap_t* heap, size_t size, size_t align)
+{
+    heap_block_t* block;
+    size_t needed;
+    size_t search;
+    size_t block_size;
+
+    if (size == 0 || (align & (align - 1)) != 0 || size > (SIZE_MAX >> 2)) {
+        return NULL;
+    }
+    if (align < HEAP_ALIGN) {
+        align = HEAP_ALIGN;
+    }
+
+    needed = (size + HEAP_HEADER_SIZE + HEAP_ALIGN - 1) & ~(HEAP_ALIGN - 1);
+    if (needed < HEAP_MIN_BLOCK) {
+        needed = HEAP_MIN_BLOCK;
+    }
+
+    // Room to move the payload to a stricter alignment, the gap becoming a free block
+    search = needed;
+    if (align > HEAP_ALIGN) {
+        search += align + HEAP_MIN_BLOCK;
+    }
+
+    block = heap_find(heap, search);
+    if (block == NULL) {
+        return NULL;
+    }
+    heap_remove(heap, block);
+    block_size = heap_block_size(block);
+
+    if (align > HEAP_ALIGN) {
+        uintptr_t payload = ((uintptr_t)block + HEAP_HEADER_SIZE + align - 1) & ~(align - 1);
+        size_t gap = payload - HEAP_HEADER_SIZE - (uintptr_t)block;
+
+        // The gap must be able to hold a free block
+        while (gap != 0 && gap < HEAP_MIN_BLOCK) {
+            gap += align;
+        }
+
+        if (gap != 0) {
+            heap_block_t* aligned = (heap_block_t*)((uintptr_t)block + gap);
+            aligned->size = block_size - gap;   // Previous (the gap) is free
+            block->size = gap | (block->size & HEAP_PREV_USED);
+            heap_insert(heap, block);
+            block = aligned;
+            block_size -= gap;
+        }
+    }
+
+    if (block_size - needed >= HEAP_MIN_BLOCK) {
+        // Split, the remainder keeps the next block's PREV_USED cleared
+        heap_block_t* remainder = (heap_block_t*)((uintptr_t)block + needed);
+        remainder->size = (block_size - needed) | HEAP_PREV_USED;
+        heap_insert(heap, remainder);
+        block_size = needed;
+    } else {
+        heap_next_block(block)->size |= HEAP_PREV_USED;
+    }
+
+    block->size = block_size | HEAP_USED | (block->size & HEAP_PREV_USED);
+
+    heap->used += block_size;
+    if (heap->used > heap->peak) {
+        heap->peak = heap->used;
+    }
+
+    return heap_payload(block);
+}
+
+void heap_free(heap_t* heap, void* ptr)
+{
+    heap_block_t* block;
+    heap_block_t* next;
+    size_t size;
+    size_t prev_used;
+
+    if (ptr == NULL) {
+        return;
+    }
+
+    block = heap_header(ptr);
+    size = heap_block_size(block);
+    prev_used = block->size & HEAP_PREV_USED;
+    heap->used -= size;
+
+    // Coalesce with the next block
+    next = heap_next_block(block);
+    if (!(next->size & HEAP_USED)) {
+        heap_remove(heap, next);
+        size += heap_block_size(next);
+    } else {
+        next->size &= ~HEAP_PREV_USED;
+    }
+
+    // Coalesce with the previous block, found through its footer
+    if (!prev_used) {
+        size_t prev_size = *(size_t*)((uintptr_t)block - sizeof(size_t));
+        heap_block_t* prev = (heap_block_t*)((uintptr_t)block - prev_size);
+        heap_remove(heap, prev);
+        size += prev_size;
+        block = prev;
+        // Two free blocks are never adjacent
+        prev_used = HEAP_PREV_USED;
+    }
+
+    block->size = size | prev_used;
+    heap_insert(heap, block);
+}
+
+void* heap_realloc(heap_t* heap, void* ptr, size_t size)
+{
+    void* new_ptr;
+    size_t old_size;
+
+    if (ptr == NULL) {
+        return heap_alloc(heap, size, HEAP_ALIGN);
+    }
+    if (size == 0) {
+        heap_free(heap, ptr);
+        return NULL;
+    }
+
+    old_size = heap_usable_size(ptr);
+    if (size <= old_size) {
+        return ptr;
+    }
+
+    new_ptr = heap_alloc(heap, size, HEAP_ALIGN);
+    if (new_ptr == NULL) {
+        return NULL;
+    }
+    memcpy(new_ptr, ptr, old_size);
+    heap_free(heap, ptr);
+    return new_ptr;
+}
+
+size_t heap_usable_size(void* ptr)
+{
+    if (ptr == NULL) {
+        return 0;
+    }
+    return heap_block_size(heap_header(ptr)) - HEAP_HEADER_SIZE;
+}
+
+size_t heap_get_used(heap_t* heap)
+{
+    return heap->used;
+}
+
+size_t heap_get_peak(heap_t* heap)
+{
+    return heap->peak;
+}
+
+size_t heap_get_free(heap_t* heap)
+{
+    size_t free_bytes = 0;
+
+    for (uint32_t i = 0; i < HEAP_NUM_BINS; i++) {
+        for (heap_block_t* block = heap->bins[i]; block != NULL; block = block->next) {
+            free_bytes += heap_block_size(block);
+        }
+    }
+    return free_bytes;
+}
+
+size_t heap_get_largest_free(heap_t* heap)
+{
+    size_t largest = 0;
+
+    // Only the highest non-empty bin can hold the largest block
+    for (int i = HEAP_NUM_BINS - 1; i >= 0; i--) {
+        if (heap->bitmap & ((uintptr_t)1 << i)) {
+            for (heap_block_t* block = heap->bins[i]; block != NULL; block = block->next) {
+                if (heap_block_size(block) > largest) {
+                    largest = heap_block_size(block);
+                }
+            }
+            break;
+        }
+    }
+    return largest;
+}
+
+// Default heap
+
+static heap_t* uninasoc_heap_get()
+{
+    if (!uninasoc_heap_ready) {
+        if (heap_init(&uninasoc_heap, HEAP_BASEADDR, HEAP_ENDADDR - HEAP_BASEADDR) != UNINASOC_OK) {
+            return NULL;
+        }
+        uninasoc_heap_ready = 1;
+    }
+    return &uninasoc_heap;
+}
+
+void* malloc(size_t size)
+{
+    heap_t* heap = uninasoc_heap_get();
+    return heap ? heap_alloc(heap, size, HEAP_ALIGN) : NULL;
+}
+
+void* calloc(size_t num, size_t size)
+{
+    void* ptr;
+
+    if (size != 0 && num > SIZE_MAX / size) {
+        return NULL;
+    }
+    ptr = malloc(num * size);
+    if (ptr != NULL) {
+        memset(ptr, 0, num * size);
+    }
+    return ptr;
+}
+
+void* realloc(void* ptr, size_t size)
+{
+    heap_t* heap = uninasoc_heap_get();
+    return heap ? heap_realloc(heap, ptr, size) : NULL;
+}
+
+void free(void* ptr)
+{
+    if (ptr != NULL && uninasoc_heap_ready) {
+        heap_free(&uninasoc_heap, ptr);
+    }
+}
@@ -0,0 +1,321 @@
+// Description:
+//  This file implements all the HLS CONV2D accelerator related functions
+//
+//  Queue protocol (ap_ctrl_hs):
+//      - Argument registers can be rewritten as soon as ap_ready is raised for the running job.
+//      - On ap_ready, the driver writes the next job's arguments and raises ap_start again,
+//        so the kernel restarts without waiting for ap_done to be serviced.
+//      - auto_restart is intentionally left off: it re-raises ap_start on ap_ready with the
+//        current argument registers, which would re-run the last job once the queue drains.
+
+#include "uninasoc.h"
+
+#ifdef HLS_CONTROL_IS_ENABLED
+
+#include "io.h"
+#include <stdint.h>
+#include <stddef.h>
+
+// Registers (from the Vitis HLS generated xkrnl_conv_hbus_hw.h)
+#define HLS_CONV_AP_CTRL        0x00 // Control signals
+#define HLS_CONV_GIE            0x04 // Global Interrupt Enable Register
+#define HLS_CONV_IER            0x08 // IP Interrupt Enable Register
+#define HLS_CONV_ISR            0x0c // IP Interrupt Status Register (Toggle On Write)
+#define HLS_CONV_I_DATA         0x10 // I address [31:0]
+#define HLS_CONV_I_DATA_HI      0x14 // I address [63:32]
+#define HLS_CONV_W_DATA         0x1c // W address [31:0]
+#define HLS_CONV_W_DATA_HI      0x20 // W address [63:32]
+#define HLS_CONV_O_DATA         0x28 // O address [31:0]
+#define HLS_CONV_O_DATA_HI      0x2c // O address [63:32]
+#define HLS_CONV_N_INPUT_DATA   0x34 // N_input
+#define HLS_CONV_C_INPUT_DATA   0x3c // C_input
+#define HLS_CONV_K_INPUT_DATA   0x44 // K_input
+
+// AP_CTRL bits
+#define HLS_CONV_AP_START       (1 << 0)
+#define HLS_CONV_AP_DONE        (1 << 1)
+#define HLS_CONV_AP_IDLE        (1 << 2)
+
+// IER/ISR bits
+#define HLS_CONV_INT_AP_DONE    (1 << 0)
+#define HLS_CONV_INT_AP_READY   (1 << 1)
+
+#define HLS_CONV_QUEUE_MASK     (HLS_CONV_QUEUE_DEPTH - 1)
+
+#if (HLS_CONV_QUEUE_DEPTH & HLS_CONV_QUEUE_MASK) != 0
+#error "HLS_CONV_QUEUE_DEPTH must be a power of two"
+#endif
+
+// Extend this function implementation in case you add more accelerators
+static inline int hls_conv_assert(hls_conv_t* conv)
+{
+    if (conv->base_addr != HLS_CONTROL_BASEADDR) {
+        return UNINASOC_ERROR;
+    }
+    return UNINASOC_OK;
+}
+
+// Lower 32 bits of the cycle counter, enough for wrap-safe differences
+static inline uint32_t hls_conv_cycles()
+{
+    return perf_cycles32();
+}
+
+// Upper half of a buffer address, always zero on RV32
+static inline uint32_t hls_conv_addr_hi(uintptr_t addr)
+{
+    return (uint32_t)((uint64_t)addr >> 32);
+}
+
+// Write a register through its shadow copy, skipping the access if the value is unchanged
+static inline void hls_conv_write_shadow(hls_conv_t* conv, uintptr_t offset, uint32_t* shadow, uint32_t val)
+{
+    if (*shadow != val) {
+        iowrite32(conv->base_addr + offset, val);
+        *shadow = val;
+        conv->stats.mmio_writes++;
+    }
+}
+
+// Write the arguments of the next pending job and raise ap_start.
+// Must be called with the interrupts disabled or from the interrupt handler
+static void hls_conv_launch_next(hls_conv_t* conv)
+{
+    uint32_t begin = hls_conv_cycles();
+    hls_conv_job_t* job = conv->queue[conv->launch_idx & HLS_CONV_QUEUE_MASK];
+
+    // Only the arguments that differ from the previous job are written.
+    // Upper address halves only change when buffers cross a 4 GB boundary
+    hls_conv_write_shadow(conv, HLS_CONV_I_DATA, &conv->shadow.i, (uint32_t)job->input);
+    hls_conv_write_shadow(conv, HLS_CONV_I_DATA_HI, &conv->shadow.i_hi, hls_conv_addr_hi(job->input));
+    hls_conv_write_shadow(conv, HLS_CONV_W_DATA, &conv->shadow.w, (uint32_t)job->weights);
+    hls_conv_write_shadow(conv, HLS_CONV_W_DATA_HI, &conv->shadow.w_hi, hls_conv_addr_hi(job->weights));
+    hls_conv_write_shadow(conv, HLS_CONV_O_DATA, &conv->shadow.o, (uint32_t)job->output);
+    hls_conv_write_shadow(conv, HLS_CONV_O_DATA_HI, &conv->shadow.o_hi, hls_conv_addr_hi(job->output));
+    hls_conv_write_shadow(conv, HLS_CONV_N_INPUT_DATA, &conv->shadow.n, job->n);
+    hls_conv_write_shadow(conv, HLS_CONV_C_INPUT_DATA, &conv->shadow.c, job->c);
+    hls_conv_write_shadow(conv, HLS_CONV_K_INPUT_DATA, &conv->shadow.k, job->k);
+
+    job->start_cycle = hls_conv_cycles();
+    if (conv->stats.jobs == 0 && conv->done_idx == conv->launch_idx) {
+        conv->stats.first_start_cycle = job->start_cycle;
+    }
+
+    conv->launch_idx++;
+    conv->staged = 1;
+
+    // If the kernel is still running, ap_start is held until its next ap_ready.
+    // Blind write: auto_restart is never set, so there is nothing to preserve.
+    // The only barrier of the launch: the buffers written by the core must be visible first
+    iowrite32_fenced(conv->base_addr + HLS_CONV_AP_CTRL, HLS_CONV_AP_START);
+    conv->stats.mmio_writes++;
+
+    conv->stats.launches++;
+    conv->stats.launch_cycles += hls_conv_cycles() - begin;
+}
+
+int hls_conv_init(hls_conv_t* conv)
+{
+    if (hls_conv_assert(conv) != UNINASOC_OK) {
+        return UNINASOC_ERROR;
+    }
+
+    conv->tail = 0;
+    conv->launch_idx = 0;
+    conv->done_idx = 0;
+    conv->staged = 0;
+    hls_conv_reset_stats(conv);
+
+    // Drop the completed jobs of a previous run, not collected yet: the handler (producer)
+    // is idle until the interrupts are enabled below
+    if (conv->completed != NULL) {
+        conv->completed->head = conv->completed->tail;
+    }
+
+    // Drop any stale interrupt status
+    uint32_t isr = ioread32(conv->base_addr + HLS_CONV_ISR);
+    iowrite32(conv->base_addr + HLS_CONV_ISR, isr);
+
+    // Synchronize the shadow copies with a known register state
+    conv->shadow.i = 0;
+    conv->shadow.i_hi = 0;
+    conv->shadow.w = 0;
+    conv->shadow.w_hi = 0;
+    conv->shadow.o = 0;
+    conv->shadow.o_hi = 0;
+    conv->shadow.n = 0;
+    conv->shadow.c = 0;
+    conv->shadow.k = 0;
+    iowrite32(conv->base_addr + HLS_CONV_I_DATA, 0);
+    iowrite32(conv->base_addr + HLS_CONV_I_DATA_HI, 0);
+    iowrite32(conv->base_addr + HLS_CONV_W_DATA, 0);
+    iowrite32(conv->base_addr + HLS_CONV_W_DATA_HI, 0);
+    iowrite32(conv->base_addr + HLS_CONV_O_DATA, 0);
+    iowrite32(conv->base_addr + HLS_CONV_O_DATA_HI, 0);
+    iowrite32(conv->base_addr + HLS_CONV_N_INPUT_DATA, 0);
+    iowrite32(conv->base_addr + HLS_CONV_C_INPUT_DATA, 0);
+    iowrite32(conv->base_addr + HLS_CONV_K_INPUT_DATA, 0);
+
+    // ap_ready drives the queue, ap_done the completions
+    conv->shadow.ier = HLS_CONV_INT_AP_DONE | HLS_CONV_INT_AP_READY;
+    conv->shadow.gie = 0x1;
+    iowrite32(conv->base_addr + HLS_CONV_IER, conv->shadow.ier);
+    iowrite32(conv->base_addr + HLS_CONV_GIE, conv->shadow.gie);
+
+    return UNINASOC_OK;
+}
+
+int hls_conv_submit(hls_conv_t* conv, hls_conv_job_t* job)
+{
+    if (hls_conv_assert(conv) != UNINASOC_OK) {
+        return UNINASOC_ERROR;
+    }
+
+    int ret = UNINASOC_OK;
+
+    // The queue is shared with the interrupt handler
+    uintptr_t mstatus;
+    asm volatile("csrrc %0, mstatus, 0x8" : "=r"(mstatus));
+
+    uint32_t depth = conv->tail - conv->done_idx;
+    if (depth == HLS_CONV_QUEUE_DEPTH) {
+        ret = UNINASOC_ERROR;
+    } else {
+        job->submit_cycle = hls_conv_cycles();
+        conv->queue[conv->tail & HLS_CONV_QUEUE_MASK] = job;
+        conv->tail++;
+
+        if (depth + 1 > conv->stats.max_depth) {
+            conv->stats.max_depth = depth + 1;
+        }
+
+        // Launch right away if the kernel already consumed the previous arguments
+        if (!conv->staged) {
+            hls_conv_launch_next(conv);
+        }
+    }
+
+    if (mstatus & 0x8) {
+        asm volatile("csrs mstatus, 0x8");
+    }
+
+    return ret;
+}
+
+int hls_conv_is_busy(hls_conv_t* conv)
+{
+    return conv->done_idx != conv->tail;
+}
+
+int hls_conv_wait(hls_conv_t* conv)
+{
+    if (hls_conv_assert(conv) != UNINASOC_OK) {
+        return UNINASOC_ERROR;
+    }
+
+    // Disable interrupts (MIE) so that the completion cannot slip in between
+    // the check and the wfi. The wfi still wakes up on the pending interrupt,
+    // which is then taken in the short window where MIE is set.
+    // The caller's MIE is restored on return
+    uintptr_t mstatus;
+    asm volatile("csrrc %0, mstatus, 0x8" : "=r"(mstatus));
+
+    while (hls_conv_is_busy(conv)) {
+        asm volatile("wfi");
+        asm volatile("csrs mstatus, 0x8");
+        asm volatile("csrc mstatus, 0x8");
+    }
+
+    if (mstatus & 0x8) {
+        asm volatile("csrs mstatus, 0x8");
+    }
+
+    return UNINASOC_OK;
+}
+
+hls_conv_job_t* hls_conv_get_completed(hls_conv_t* conv)
+{
+    void* job;
+
+    if (conv->completed == NULL || spsc_queue_pop(conv->completed, &job) != UNINASOC_OK) {
+        return NULL;
+    }
+    return (hls_conv_job_t*)job;
+}
+
+void hls_conv_reset_stats(hls_conv_t* conv)
+{
+    conv->stats.jobs = 0;
+    conv->stats.max_depth = 0;
+    conv->stats.total_latency = 0;
+    conv->stats.max_latency = 0;
+    conv->stats.first_start_cycle = 0;
+    conv->stats.last_done_cycle = 0;
+    conv->stats.launches = 0;
+    conv->stats.launch_cycles = 0;
+    conv->stats.mmio_writes = 0;
+}
+
+// Complete the oldest launched job: statistics, publication and callback
+static void hls_conv_retire(hls_conv_t* conv)
+{
+    hls_conv_job_t* job = conv->queue[conv->done_idx & HLS_CONV_QUEUE_MASK];
+    conv->done_idx++;
+
+    job->done_cycle = hls_conv_cycles();
+    uint32_t latency = job->done_cycle - job->submit_cycle;
+    conv->stats.jobs++;
+    conv->stats.total_latency += latency;
+    if (latency > conv->stats.max_latency) {
+        conv->stats.max_latency = latency;
+    }
+    conv->stats.last_done_cycle = job->done_cycle;
+
+    // Publish before the callback, which may look for it
+    if (conv->completed != NULL) {
+        spsc_queue_push(conv->completed, job);
+    }
+
+    if (job->callback != NULL) {
+        job->callback(job->callback_arg);
+    }
+}
+
+void hls_conv_irq_handler(hls_conv_t* conv)
+{
+    // Acknowledge (ISR is toggle-on-write), the interrupt line is level-sensitive
+    // and must be lowered before the PLIC completion.
+    // Fenced: the outputs of the completed jobs are read after it
+    uint32_t isr = ioread32_fenced(conv->base_addr + HLS_CONV_ISR);
+    iowrite32(conv->base_addr + HLS_CONV_ISR, isr);
+
+    // ap_done is sticky: several completions can coalesce into a single interrupt.
+    // Count the launched jobs still owned by the kernel, before feeding the next one:
+    // none if idle, else the running one, plus the staged one if its ap_ready is not seen yet
+    uint32_t launched = conv->launch_idx;
+    uint32_t in_flight = 0;
+    if (isr & HLS_CONV_INT_AP_DONE) {
+        if (!(ioread32(conv->base_addr + HLS_CONV_AP_CTRL) & HLS_CONV_AP_IDLE)) {
+            in_flight = (conv->staged && !(isr & HLS_CONV_INT_AP_READY)) ? 2 : 1;
+        }
+    }
+
+    // Kernel accepted the staged arguments: feed the next job first, to keep it busy
+    if (isr & HLS_CONV_INT_AP_READY) {
+        conv->staged = 0;
+        if (conv->launch_idx != conv->tail) {
+            hls_conv_launch_next(conv);
+        }
+    }
+
+    // Complete every finished job, oldest first: at least one, since ap_done was raised
+    if (isr & HLS_CONV_INT_AP_DONE) {
+        uint32_t outstanding = launched - conv->done_idx;
+        uint32_t finished = outstanding > in_flight ? outstanding - in_flight : (outstanding != 0);
+        while (finished--) {
+            hls_conv_retire(conv);
+        }
+    }
+}
+
+#endif
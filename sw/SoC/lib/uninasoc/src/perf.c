@@ -0,0 +1,151 @@
+// Description:
+//  This file implements the performance counters API
+
+#include "uninasoc.h"
+#include "perf.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef CORE_PICORV32
+
+// mhpmcounter CSRs are selected at compile time
+#define PERF_HPM_CASE(n)                                    \
+    case (n - 3):                                           \
+        return PERF_READ_CSR64(mhpmcounter##n);
+
+#define PERF_HPM_EVENT_CASE(n)                              \
+    case (n - 3):                                           \
+        asm volatile("csrw mhpmevent" #n ", %0" ::"r"(event)); \
+        break;
+
+void perf_init()
+{
+#ifdef PERF_HAS_MCOUNTINHIBIT
+    // Clear mcountinhibit: mcycle (bit 0), minstret (bit 2) and mhpmcounters (bits 3+)
+    asm volatile("csrw mcountinhibit, zero");
+#endif
+}
+
+uint64_t perf_hpm_read(uint32_t index)
+{
+    if (index >= PERF_NUM_HPM_COUNTERS) {
+        return 0;
+    }
+
+    switch (index) {
+#if PERF_NUM_HPM_COUNTERS > 0
+        PERF_HPM_CASE(3)
+#endif
+#if PERF_NUM_HPM_COUNTERS > 1
+        PERF_HPM_CASE(4)
+#endif
+#if PERF_NUM_HPM_COUNTERS > 2
+        PERF_HPM_CASE(5)
+#endif
+#if PERF_NUM_HPM_COUNTERS > 3
+        PERF_HPM_CASE(6)
+#endif
+#if PERF_NUM_HPM_COUNTERS > 4
+        PERF_HPM_CASE(7)
+#endif
+#if PERF_NUM_HPM_COUNTERS > 5
+        PERF_HPM_CASE(8)
+#endif
+    default:
+        return 0;
+    }
+}
+
+void perf_hpm_set_event(uint32_t index, uintptr_t event)
+{
+    switch (index) {
+#if PERF_NUM_HPM_COUNTERS > 0
+        PERF_HPM_EVENT_CASE(3)
+#endif
+#if PERF_NUM_HPM_COUNTERS > 1
+        PERF_HPM_EVENT_CASE(4)
+#endif
+#if PERF_NUM_HPM_COUNTERS > 2
+        PERF_HPM_EVENT_CASE(5)
+#endif
+#if PERF_NUM_HPM_COUNTERS > 3
+        PERF_HPM_EVENT_CASE(6)
+#endif
+#if PERF_NUM_HPM_COUNTERS > 4
+        PERF_HPM_EVENT_CASE(7)
+#endif
+#if PERF_NUM_HPM_COUNTERS > 5
+        PERF_HPM_EVENT_CASE(8)
+#endif
+    default:
+        (void)event;
+        break;
+    }
+}
+
+void perf_region_begin(perf_region_t* region)
+{
+    perf_snapshot(&region->start);
+}
+
+void perf_region_end(perf_region_t* region)
+{
+    perf_snapshot_t end;
+    perf_snapshot(&end);
+
+    uint64_t cycles = end.cycles - region->start.cycles;
+    region->cycles += cycles;
+    region->instret += end.instret - region->start.instret;
+    region->count++;
+    if (cycles > region->max_cycles) {
+        region->max_cycles = cycles;
+    }
+}
+
+#else // CORE_PICORV32
+
+void perf_init() { }
+uint64_t perf_hpm_read(uint32_t index) { return 0; }
+void perf_hpm_set_event(uint32_t index, uintptr_t event) { }
+void perf_region_begin(perf_region_t* region) { }
+void perf_region_end(perf_region_t* region) { }
+
+#endif // CORE_PICORV32
+
+void perf_region_reset(perf_region_t* region)
+{
+    region->count = 0;
+    region->cycles = 0;
+    region->instret = 0;
+    region->max_cycles = 0;
+}
+
+void perf_report(perf_region_t* regions[], size_t num_regions)
+{
+#ifdef CORE_PICORV32
+    printf("[PERF] Counters not available on this core\n\r");
+#else
+    printf("[PERF] region: count, cycles (total/avg/max), instret, CPI\n\r");
+    for (size_t i = 0; i < num_regions; i++) {
+        perf_region_t* region = regions[i];
+        if (region->count == 0) {
+            printf("    %s: -\n\r", region->name);
+            continue;
+        }
+
+        // CPI with two decimals, no floating point support needed
+        uint32_t cpi = region->instret ? (uint32_t)((region->cycles * 100) / region->instret) : 0;
+        printf("    %s: %u, %llu/%llu/%llu, %llu, %u.%02u\n\r",
+            region->name,
+            region->count,
+            region->cycles,
+            region->cycles / region->count,
+            region->max_cycles,
+            region->instret,
+            cpi / 100,
+            cpi % 100
+        );
+    }
+#endif
+}
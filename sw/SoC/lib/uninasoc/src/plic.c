@@ -10,26 +10,52 @@
 #include "io.h"
 #include <stdint.h>
 
-#define MAX_SOURCES 3
+// Number of sources configured with plic_configure()
+static size_t sources = PLIC_NUM_SOURCES - 1;
 
-// In this example, only 4 interrupts sources are supported in the SoC
+// Registered handlers, indexed by source
+typedef struct {
+    plic_handler_t handler;
+    void* arg;
+    uint32_t priority;  // Cached, used as threshold when nesting
+    uint32_t count;
+} plic_entry_t;
 
-static size_t sources = MAX_SOURCES;
+static plic_entry_t handlers[PLIC_NUM_SOURCES];
+
+// Run handlers with interrupts enabled
+static int nesting = 0;
+
+static inline int plic_is_valid(plic_source_t source)
+{
+    return (source > PLIC_RESERVED_INTERRUPT) && (source < PLIC_NUM_SOURCES);
+}
 
 int plic_init()
 {
-    // No-op
+    // Start from a known state: nothing enabled, every source masked
+    iowrite32(PLIC_INT_ENABLE_CTX0, 0);
+    iowrite32(PLIC_THRESHOLD_CTX0, 0);
+    for (int i = 1; i < PLIC_NUM_SOURCES; i++) {
+        iowrite32(PLIC_PRIORITY(i), 0);
+        handlers[i].handler = NULL;
+        handlers[i].arg = NULL;
+        handlers[i].priority = 0;
+        handlers[i].count = 0;
+    }
+    sources = PLIC_NUM_SOURCES - 1;
+    nesting = 0;
     return UNINASOC_OK;
 }
 
 void plic_configure(uint32_t* priorities, size_t source_num){
 
-    if(source_num < MAX_SOURCES)
+    if(source_num < PLIC_NUM_SOURCES)
         sources = source_num;
 
-    //Set interrupt priorities
+    //Set interrupt priorities, priorities[0] is source 1
     for (int i = 1; i <= sources; i++) {
-        iowrite32(PLIC_BASEADDR + (0x4 * i) , priorities[i]);
+        plic_set_priority(i, priorities[i - 1]);
     }
 
 }
@@ -42,11 +68,39 @@ void plic_enable_all(){
         // bits 0-31 represent sources 0-31, so
         // for example to enable the peripherals from 1 to 3
         // must write powers of 2 with exponents from 1 to 3
-        enable += (1 << i);
+        enable |= (1 << i);
     }
     iowrite32(PLIC_INT_ENABLE_CTX0 , enable);
 }
 
+void plic_set_priority(plic_source_t source, uint32_t priority){
+    iowrite32(PLIC_PRIORITY(source), priority);
+    if (plic_is_valid(source))
+        handlers[source].priority = priority;
+}
+
+void plic_enable(plic_source_t source){
+
+    uint32_t enable = ioread32(PLIC_INT_ENABLE_CTX0);
+    enable |= (1 << source);
+    iowrite32(PLIC_INT_ENABLE_CTX0 , enable);
+}
+
+void plic_disable(plic_source_t source){
+
+    uint32_t enable = ioread32(PLIC_INT_ENABLE_CTX0);
+    enable &= ~(1 << source);
+    iowrite32(PLIC_INT_ENABLE_CTX0 , enable);
+}
+
+void plic_set_threshold(uint32_t threshold){
+    iowrite32(PLIC_THRESHOLD_CTX0, threshold);
+}
+
+uint32_t plic_get_threshold(){
+    return ioread32(PLIC_THRESHOLD_CTX0);
+}
+
 uint32_t plic_claim(){
     return ioread32(PLIC_CLAIM_CTX0);
 }
@@ -54,3 +108,94 @@ uint32_t plic_claim(){
 void plic_complete(uint32_t interrupt_id){
     iowrite32(PLIC_COMPLETE_CTX0, interrupt_id);
 }
+
+int plic_register_handler(plic_source_t source, plic_handler_t handler, void* arg, uint32_t priority){
+
+    if (!plic_is_valid(source) || handler == NULL || priority == 0 || priority > PLIC_MAX_PRIORITY)
+        return UNINASOC_ERROR;
+
+    handlers[source].handler = handler;
+    handlers[source].arg = arg;
+    handlers[source].count = 0;
+
+    plic_set_priority(source, priority);
+    plic_enable(source);
+    return UNINASOC_OK;
+}
+
+void plic_unregister_handler(plic_source_t source){
+
+    if (!plic_is_valid(source))
+        return;
+
+    plic_disable(source);
+    plic_set_priority(source, 0);
+    handlers[source].handler = NULL;
+    handlers[source].arg = NULL;
+}
+
+// Run a handler with interrupts enabled and the threshold raised to its priority
+static void plic_run_nested(plic_entry_t* entry){
+
+#ifndef CORE_PICORV32
+    uintptr_t mepc;
+    uintptr_t mstatus;
+    uint32_t threshold;
+
+    // A nested trap overwrites mepc and mstatus
+    asm volatile("csrr %0, mepc" : "=r"(mepc));
+    asm volatile("csrr %0, mstatus" : "=r"(mstatus));
+
+    // Only strictly higher priorities can preempt. Never lower an already raised
+    // threshold (e.g. a lower-priority source claimed while draining)
+    threshold = plic_get_threshold();
+    plic_set_threshold(entry->priority > threshold ? entry->priority : threshold);
+
+    asm volatile("csrs mstatus, 0x8");
+    entry->handler(entry->arg);
+    asm volatile("csrc mstatus, 0x8");
+
+    plic_set_threshold(threshold);
+    asm volatile("csrw mepc, %0" ::"r"(mepc));
+    asm volatile("csrw mstatus, %0" ::"r"(mstatus));
+#else
+    entry->handler(entry->arg);
+#endif
+}
+
+void plic_set_nesting(int enable){
+    nesting = enable;
+}
+
+__hot uint32_t plic_dispatch(){
+
+    uint32_t serviced = 0;
+    uint32_t interrupt_id;
+
+    // Drain: a source raised while servicing the previous one is claimed
+    // here instead of costing another trap
+    while ((interrupt_id = plic_claim()) != PLIC_RESERVED_INTERRUPT) {
+        if (interrupt_id < PLIC_NUM_SOURCES && handlers[interrupt_id].handler != NULL) {
+            if (nesting)
+                plic_run_nested(&handlers[interrupt_id]);
+            else
+                handlers[interrupt_id].handler(handlers[interrupt_id].arg);
+            handlers[interrupt_id].count++;
+        } else {
+            // Nobody can acknowledge it at the device, mask it
+            plic_disable(interrupt_id);
+        }
+        plic_complete(interrupt_id);
+        serviced++;
+    }
+
+    return serviced;
+}
+
+uint32_t plic_get_count(plic_source_t source){
+
+    if (!plic_is_valid(source))
+        return 0;
+
+    return handlers[source].count;
+}
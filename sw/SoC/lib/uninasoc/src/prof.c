@@ -0,0 +1,88 @@
+// Description:
+//  This file implements the PC-sampling profiler
+
+#include "uninasoc.h"
+
+#if defined(TIM_IS_ENABLED) && !defined(CORE_PICORV32)
+
+#include <stdint.h>
+#include <stddef.h>
+
+int prof_init(prof_t* prof, uint32_t* buckets, uint32_t num_buckets, uint32_t period)
+{
+    if (buckets == NULL || num_buckets == 0 || prof->timer.base_addr != TIM1_BASEADDR) {
+        return UNINASOC_ERROR;
+    }
+
+    uintptr_t text_start = (uintptr_t)&_text_start;
+    uintptr_t text_size = (uintptr_t)&_text_end - text_start;
+
+    // Smallest bucket size covering the whole .text
+    uint32_t shift = PROF_MIN_SHIFT;
+    while (((text_size + (1 << shift) - 1) >> shift) > num_buckets) {
+        shift++;
+    }
+
+    prof->buckets = buckets;
+    prof->num_buckets = num_buckets;
+    prof->shift = shift;
+    prof->text_start = text_start;
+    prof_reset(prof);
+
+    // Periodic interrupt, one sample every period timer cycles
+    prof->timer.counter = period;
+    prof->timer.reload_mode = TIM_RELOAD_AUTO;
+    prof->timer.count_direction = TIM_COUNT_DOWN;
+
+    if (xlnx_tim_configure(&prof->timer) != UNINASOC_OK) {
+        return UNINASOC_ERROR;
+    }
+    return xlnx_tim_enable_int(&prof->timer);
+}
+
+int prof_start(prof_t* prof)
+{
+    return xlnx_tim_start(&prof->timer);
+}
+
+int prof_stop(prof_t* prof)
+{
+    return xlnx_tim_stop(&prof->timer);
+}
+
+void prof_reset(prof_t* prof)
+{
+    memset(prof->buckets, 0, prof->num_buckets * sizeof(uint32_t));
+    prof->samples = 0;
+    prof->dropped = 0;
+}
+
+void prof_irq_handler(prof_t* prof)
+{
+    // Interrupted PC, read before anything else can overwrite it
+    uintptr_t pc;
+    asm volatile("csrr %0, mepc" : "=r"(pc));
+
+    uintptr_t index = (pc - prof->text_start) >> prof->shift;
+    if (pc >= prof->text_start && index < prof->num_buckets) {
+        prof->buckets[index]++;
+        prof->samples++;
+    } else {
+        prof->dropped++;
+    }
+
+    xlnx_tim_clear_int(&prof->timer);
+}
+
+void prof_dump(prof_t* prof)
+{
+    printf("PROF_BEGIN 0x%08lx %u %u %u\n\r", (unsigned long)prof->text_start, prof->shift, prof->samples, prof->dropped);
+    for (uint32_t i = 0; i < prof->num_buckets; i++) {
+        if (prof->buckets[i] != 0) {
+            printf("0x%08lx %u\n\r", (unsigned long)(prof->text_start + ((uintptr_t)i << prof->shift)), prof->buckets[i]);
+        }
+    }
+    printf("PROF_END\n\r");
+}
+
+#endif
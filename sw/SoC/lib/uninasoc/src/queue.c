@@ -0,0 +1,119 @@
+// Description:
+//  This file implements the lock-free SPSC and MPSC ring queues (see queue.h)
+
+#include "uninasoc.h"
+#include <stdint.h>
+
+static inline int queue_size_is_valid(uint32_t size)
+{
+    return size != 0 && (size & (size - 1)) == 0;
+}
+
+int spsc_queue_init(spsc_queue_t* queue, void** slots, uint32_t size)
+{
+    if (slots == NULL || !queue_size_is_valid(size)) {
+        return UNINASOC_ERROR;
+    }
+
+    queue->slots = slots;
+    queue->mask = size - 1;
+    queue->head = 0;
+    queue->tail = 0;
+    return UNINASOC_OK;
+}
+
+int spsc_queue_push(spsc_queue_t* queue, void* data)
+{
+    uint32_t tail = queue->tail;
+
+    if (tail - atomic_load_acquire32(&queue->head) > queue->mask) {
+        return UNINASOC_ERROR;
+    }
+
+    queue->slots[tail & queue->mask] = data;
+    // Publish the slot before the index
+    atomic_store_release32(&queue->tail, tail + 1);
+    return UNINASOC_OK;
+}
+
+int spsc_queue_pop(spsc_queue_t* queue, void** data)
+{
+    uint32_t head = queue->head;
+
+    if (head == atomic_load_acquire32(&queue->tail)) {
+        return UNINASOC_ERROR;
+    }
+
+    *data = queue->slots[head & queue->mask];
+    // Release the slot after reading it
+    atomic_store_release32(&queue->head, head + 1);
+    return UNINASOC_OK;
+}
+
+uint32_t spsc_queue_count(spsc_queue_t* queue)
+{
+    return queue->tail - queue->head;
+}
+
+int mpsc_queue_init(mpsc_queue_t* queue, mpsc_cell_t* cells, uint32_t size)
+{
+    if (cells == NULL || !queue_size_is_valid(size)) {
+        return UNINASOC_ERROR;
+    }
+
+    for (uint32_t i = 0; i < size; i++) {
+        cells[i].sequence = i;
+        cells[i].data = NULL;
+    }
+    queue->cells = cells;
+    queue->mask = size - 1;
+    queue->head = 0;
+    queue->tail = 0;
+    return UNINASOC_OK;
+}
+
+int mpsc_queue_push(mpsc_queue_t* queue, void* data)
+{
+    uint32_t tail = queue->tail;
+    mpsc_cell_t* cell;
+
+    while (1) {
+        cell = &queue->cells[tail & queue->mask];
+        int32_t diff = (int32_t)(atomic_load_acquire32(&cell->sequence) - tail);
+
+        if (diff == 0) {
+            // Free cell, claim it
+            uint32_t old = atomic_cas32(&queue->tail, tail, tail + 1);
+            if (old == tail) {
+                break;
+            }
+            tail = old;
+        } else if (diff < 0) {
+            // Not yet consumed since the previous lap
+            return UNINASOC_ERROR;
+        } else {
+            // Claimed by another producer meanwhile
+            tail = queue->tail;
+        }
+    }
+
+    cell->data = data;
+    atomic_store_release32(&cell->sequence, tail + 1);
+    return UNINASOC_OK;
+}
+
+int mpsc_queue_pop(mpsc_queue_t* queue, void** data)
+{
+    uint32_t head = queue->head;
+    mpsc_cell_t* cell = &queue->cells[head & queue->mask];
+
+    if (atomic_load_acquire32(&cell->sequence) != head + 1) {
+        return UNINASOC_ERROR;
+    }
+
+    *data = cell->data;
+    queue->head = head + 1;
+    // Hand the cell to the producers of the next lap
+    atomic_store_release32(&cell->sequence, head + queue->mask + 1);
+    return UNINASOC_OK;
+}
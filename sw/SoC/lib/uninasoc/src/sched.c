@@ -0,0 +1,293 @@
+// Description:
+//  This file implements the cooperative scheduler (see sched.h)
+
+#include "uninasoc.h"
+#include <stdint.h>
+#include <stddef.h>
+
+// Context switch frame: ra and s0-s11, padded to keep sp 16-byte aligned
+#if __riscv_xlen == 64
+#define SCHED_STORE     "sd"
+#define SCHED_LOAD      "ld"
+#define SCHED_REGBYTES  "8"
+#else
+#define SCHED_STORE     "sw"
+#define SCHED_LOAD      "lw"
+#define SCHED_REGBYTES  "4"
+#endif
+
+#define SCHED_FRAME_SLOTS 16
+#define SCHED_FRAME_SIZE  (SCHED_FRAME_SLOTS * sizeof(uintptr_t))
+
+// Save the callee-saved registers on the current stack and its pointer to *save_sp,
+// then switch to load_sp and restore the registers found there
+void sched_context_switch(uintptr_t* save_sp, uintptr_t load_sp);
+
+asm(
+    ".pushsection .hot.text, \"ax\"\n"
+    ".global sched_context_switch\n"
+    ".type sched_context_switch, @function\n"
+    "sched_context_switch:\n"
+    "   addi sp, sp, -16*" SCHED_REGBYTES "\n"
+    "   " SCHED_STORE " ra,  0*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s0,  1*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s1,  2*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s2,  3*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s3,  4*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s4,  5*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s5,  6*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s6,  7*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s7,  8*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s8,  9*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s9,  10*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s10, 11*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " s11, 12*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_STORE " sp,  0(a0)\n"
+    "   mv sp, a1\n"
+    "   " SCHED_LOAD " ra,  0*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s0,  1*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s1,  2*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s2,  3*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s3,  4*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s4,  5*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s5,  6*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s6,  7*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s7,  8*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s8,  9*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s9,  10*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s10, 11*" SCHED_REGBYTES "(sp)\n"
+    "   " SCHED_LOAD " s11, 12*" SCHED_REGBYTES "(sp)\n"
+    "   addi sp, sp, 16*" SCHED_REGBYTES "\n"
+    "   ret\n"
+    ".size sched_context_switch, .-sched_context_switch\n"
+    ".popsection\n"
+);
+
+static task_t* tasks = NULL;            // Any task of the circular list
+static task_t* current = NULL;          // Running task, NULL in the idle context
+static task_t* last = NULL;             // Last task switched out to the idle context
+static uintptr_t idle_sp;
+static uint32_t alive = 0;
+static volatile uint32_t ticks = 0;
+
+#ifdef TIM_IS_ENABLED
+static xlnx_tim_t tick_timer = {
+    .base_addr = TIM0_BASEADDR,
+    .reload_mode = TIM_RELOAD_AUTO,
+    .count_direction = TIM_COUNT_DOWN
+};
+#endif
+
+// Tick comparison, robust to the counter wrapping around
+static inline int sched_tick_reached(uint32_t tick)
+{
+    return (int32_t)(ticks - tick) >= 0;
+}
+
+static inline int sched_is_runnable(task_t* task)
+{
+    if (task->state == TASK_SLEEPING && sched_tick_reached(task->wake_tick)) {
+        task->state = TASK_READY;
+    }
+    return task->state == TASK_READY;
+}
+
+// Next runnable task after from (round-robin), from itself being the last candidate
+static task_t* sched_pick(task_t* from)
+{
+    task_t* task;
+
+    if (tasks == NULL) {
+        return NULL;
+    }
+    if (from == NULL) {
+        from = tasks;
+        if (sched_is_runnable(from)) {
+            return from;
+        }
+    }
+
+    task = from;
+    do {
+        task = task->next;
+        if (sched_is_runnable(task)) {
+            return task;
+        }
+    } while (task != from);
+
+    return NULL;
+}
+
+// First code run by a task, with its stack just set up
+static void sched_task_start()
+{
+    current->entry(current->arg);
+
+    current->state = TASK_EXITED;
+    alive--;
+    sched_yield();
+
+    // Never scheduled again
+    while (1);
+}
+
+int sched_init()
+{
+    tasks = NULL;
+    current = NULL;
+    last = NULL;
+    alive = 0;
+    ticks = 0;
+    return UNINASOC_OK;
+}
+
+int sched_create(task_t* task, task_entry_t entry, void* arg, void* stack, size_t stack_size)
+{
+    uintptr_t top;
+
+    if (task == NULL || entry == NULL || stack == NULL || stack_size < 2 * SCHED_FRAME_SIZE) {
+        return UNINASOC_ERROR;
+    }
+
+    // Initial frame, restored by the first switch: "returns" to sched_task_start
+    top = ((uintptr_t)stack + stack_size) & ~(uintptr_t)15;
+    task->sp = top - SCHED_FRAME_SIZE;
+    memset((void*)task->sp, 0, SCHED_FRAME_SIZE);
+    ((uintptr_t*)task->sp)[0] = (uintptr_t)sched_task_start;
+
+    task->state = TASK_READY;
+    task->wake_tick = 0;
+    task->entry = entry;
+    task->arg = arg;
+    task->switches = 0;
+
+    // Insert in the circular list
+    if (tasks == NULL) {
+        task->next = task;
+        tasks = task;
+    } else {
+        task->next = tasks->next;
+        tasks->next = task;
+    }
+    alive++;
+
+    return UNINASOC_OK;
+}
+
+void sched_run()
+{
+    task_t* next;
+
+    while (alive > 0) {
+        next = sched_pick(last);
+        if (next != NULL) {
+            current = next;
+            next->switches++;
+            sched_context_switch(&idle_sp, next->sp);
+            current = NULL;
+            continue;
+        }
+
+        // Nothing runnable: wait for an interrupt. MIE is cleared so that the
+        // wake-up cannot slip in between the check and the wfi, then briefly set to
+        // take the pending interrupt. The caller's MIE is restored afterwards
+#ifndef CORE_PICORV32
+        uintptr_t mstatus;
+        asm volatile("csrrc %0, mstatus, 0x8" : "=r"(mstatus));
+        if (sched_pick(last) == NULL) {
+            asm volatile("wfi");
+            asm volatile("csrs mstatus, 0x8");
+            asm volatile("csrc mstatus, 0x8");
+        }
+        if (mstatus & 0x8) {
+            asm volatile("csrs mstatus, 0x8");
+        }
+#endif
+    }
+
+    tasks = NULL;
+    last = NULL;
+}
+
+void sched_yield()
+{
+    task_t* prev = current;
+    task_t* next;
+
+    if (prev == NULL) {
+        return;
+    }
+
+    next = sched_pick(prev);
+    if (next == prev) {
+        return;
+    }
+
+    if (next == NULL) {
+        // Back to the idle context, which resumes from here
+        last = prev;
+        current = NULL;
+        sched_context_switch(&prev->sp, idle_sp);
+    } else {
+        current = next;
+        next->switches++;
+        sched_context_switch(&prev->sp, next->sp);
+    }
+}
+
+void sched_sleep_until(uint32_t tick)
+{
+    if (current == NULL) {
+        return;
+    }
+
+    current->wake_tick = tick;
+    current->state = TASK_SLEEPING;
+    sched_yield();
+}
+
+void sched_sleep(uint32_t num_ticks)
+{
+    sched_sleep_until(ticks + num_ticks);
+}
+
+task_t* sched_current()
+{
+    return current;
+}
+
+uint32_t sched_get_ticks()
+{
+    return ticks;
+}
+
+void sched_tick()
+{
+    ticks++;
+}
+
+#ifdef TIM_IS_ENABLED
+
+int sched_start_tick(uint32_t period)
+{
+    tick_timer.counter = period;
+
+    if (xlnx_tim_configure(&tick_timer) != UNINASOC_OK || xlnx_tim_enable_int(&tick_timer) != UNINASOC_OK) {
+        return UNINASOC_ERROR;
+    }
+    return xlnx_tim_start(&tick_timer);
+}
+
+int sched_stop_tick()
+{
+    xlnx_tim_stop(&tick_timer);
+    return xlnx_tim_clear_int(&tick_timer);
+}
+
+void sched_tick_handler(void* arg)
+{
+    xlnx_tim_clear_int(&tick_timer);
+    ticks++;
+}
+
+#endif
@@ -1,18 +1,202 @@
 #include "stdlib.h"
 
-// Local memcpy (byte-wise unoptimized)
-void* memcpy(void* dest, const void* src, size_t n)
+// The mem* functions move XLEN-wide words (uintptr_t) when source and destination
+// share the same alignment, with unrolled loops for the bulk of the buffer and
+// byte loops for the unaligned head and tail. Mutually misaligned buffers fall back
+// to byte copies, since misaligned accesses trap (or are split) on the supported cores.
+
+typedef uintptr_t word_t;
+
+#define WORD_SIZE       sizeof(word_t)
+#define WORD_MASK       (WORD_SIZE - 1)
+#define UNROLL          4
+#define BLOCK_SIZE      (UNROLL * WORD_SIZE)
+
+// Prevent the compiler from turning these loops back into calls to themselves
+#define NO_BUILTIN __attribute__((optimize("no-tree-loop-distribute-patterns")))
+
+// Local memcpy (XLEN-wide, unrolled)
+NO_BUILTIN void* memcpy(void* dest, const void* src, size_t n)
+{
+    unsigned char* d = (unsigned char*)dest;
+    const unsigned char* s = (const unsigned char*)src;
+
+    if ((((uintptr_t)d ^ (uintptr_t)s) & WORD_MASK) == 0) {
+        // Head: align both pointers
+        while (n > 0 && ((uintptr_t)d & WORD_MASK)) {
+            *d++ = *s++;
+            n--;
+        }
+
+        // Body: unrolled word copies
+        word_t* dw = (word_t*)d;
+        const word_t* sw = (const word_t*)s;
+        while (n >= BLOCK_SIZE) {
+            word_t w0 = sw[0];
+            word_t w1 = sw[1];
+            word_t w2 = sw[2];
+            word_t w3 = sw[3];
+            dw[0] = w0;
+            dw[1] = w1;
+            dw[2] = w2;
+            dw[3] = w3;
+            dw += UNROLL;
+            sw += UNROLL;
+            n -= BLOCK_SIZE;
+        }
+        while (n >= WORD_SIZE) {
+            *dw++ = *sw++;
+            n -= WORD_SIZE;
+        }
+
+        d = (unsigned char*)dw;
+        s = (const unsigned char*)sw;
+    }
+
+    // Tail (or whole misaligned buffer)
+    while (n > 0) {
+        *d++ = *s++;
+        n--;
+    }
+
+    return dest;
+}
+
+// Local memmove (XLEN-wide, unrolled, overlap-safe)
+NO_BUILTIN void* memmove(void* dest, const void* src, size_t n)
 {
-    for (size_t i = 0; i < n; i++) {
-        ((char*)dest)[i] = ((char*)src)[i];
+    unsigned char* d = (unsigned char*)dest;
+    const unsigned char* s = (const unsigned char*)src;
+
+    // Forward copy is safe if dest does not start inside src
+    if (d <= s || d >= s + n) {
+        return memcpy(dest, src, n);
+    }
+
+    // Backward copy, from the end of the buffers
+    d += n;
+    s += n;
+
+    if ((((uintptr_t)d ^ (uintptr_t)s) & WORD_MASK) == 0) {
+        while (n > 0 && ((uintptr_t)d & WORD_MASK)) {
+            *--d = *--s;
+            n--;
+        }
+
+        word_t* dw = (word_t*)d;
+        const word_t* sw = (const word_t*)s;
+        while (n >= BLOCK_SIZE) {
+            dw -= UNROLL;
+            sw -= UNROLL;
+            word_t w3 = sw[3];
+            word_t w2 = sw[2];
+            word_t w1 = sw[1];
+            word_t w0 = sw[0];
+            dw[3] = w3;
+            dw[2] = w2;
+            dw[1] = w1;
+            dw[0] = w0;
+            n -= BLOCK_SIZE;
+        }
+        while (n >= WORD_SIZE) {
+            *--dw = *--sw;
+            n -= WORD_SIZE;
+        }
+
+        d = (unsigned char*)dw;
+        s = (const unsigned char*)sw;
+    }
+
+    while (n > 0) {
+        *--d = *--s;
+        n--;
     }
+
+    return dest;
 }
 
-// Local memset (from https://github.com/gcc-mirror/gcc/blob/master/libiberty/memset.c)
-void* memset(void* dest, register int val, register size_t len)
+// Local memset (XLEN-wide, unrolled)
+NO_BUILTIN void* memset(void* dest, register int val, register size_t len)
 {
-    register unsigned char* ptr = (unsigned char*)dest;
-    while (len-- > 0)
-        *ptr++ = val;
+    unsigned char* d = (unsigned char*)dest;
+    unsigned char c = (unsigned char)val;
+
+    // Head: align the pointer
+    while (len > 0 && ((uintptr_t)d & WORD_MASK)) {
+        *d++ = c;
+        len--;
+    }
+
+    // Replicate the byte over a word
+    word_t w = c;
+    w |= w << 8;
+    w |= w << 16;
+#if UINTPTR_MAX > 0xFFFFFFFF
+    w |= w << 32;
+#endif
+
+    // Body: unrolled word stores
+    word_t* dw = (word_t*)d;
+    while (len >= BLOCK_SIZE) {
+        dw[0] = w;
+        dw[1] = w;
+        dw[2] = w;
+        dw[3] = w;
+        dw += UNROLL;
+        len -= BLOCK_SIZE;
+    }
+    while (len >= WORD_SIZE) {
+        *dw++ = w;
+        len -= WORD_SIZE;
+    }
+
+    // Tail
+    d = (unsigned char*)dw;
+    while (len > 0) {
+        *d++ = c;
+        len--;
+    }
+
     return dest;
 }
+
+// Local memcmp (XLEN-wide scan for the first differing word)
+NO_BUILTIN int memcmp(const void* s1, const void* s2, size_t n)
+{
+    const unsigned char* p1 = (const unsigned char*)s1;
+    const unsigned char* p2 = (const unsigned char*)s2;
+
+    if ((((uintptr_t)p1 ^ (uintptr_t)p2) & WORD_MASK) == 0) {
+        while (n > 0 && ((uintptr_t)p1 & WORD_MASK)) {
+            if (*p1 != *p2) {
+                return *p1 - *p2;
+            }
+            p1++;
+            p2++;
+            n--;
+        }
+
+        // Skip equal words, the differing one is resolved bytewise below
+        const word_t* w1 = (const word_t*)p1;
+        const word_t* w2 = (const word_t*)p2;
+        while (n >= WORD_SIZE && *w1 == *w2) {
+            w1++;
+            w2++;
+            n -= WORD_SIZE;
+        }
+
+        p1 = (const unsigned char*)w1;
+        p2 = (const unsigned char*)w2;
+    }
+
+    while (n > 0) {
+        if (*p1 != *p2) {
+            return *p1 - *p2;
+        }
+        p1++;
+        p2++;
+        n--;
+    }
+
+    return 0;
+}
@@ -0,0 +1,40 @@
+// Description:
+//  This file implements the deferred binary logging ring (see trace.h)
+
+#include "uninasoc.h"
+#include <stdint.h>
+
+#if (TRACE_NUM_RECORDS & (TRACE_NUM_RECORDS - 1)) != 0
+#error "TRACE_NUM_RECORDS must be a power of two"
+#endif
+
+trace_buffer_t trace_buffer;
+
+void trace_init()
+{
+    memset(trace_buffer.records, 0, sizeof(trace_buffer.records));
+    trace_buffer.num_records = TRACE_NUM_RECORDS;
+    trace_buffer.head = 0;
+    trace_buffer.reserved = 0;
+    trace_buffer.magic = TRACE_MAGIC;
+}
+
+void trace_dump()
+{
+    uint32_t head = trace_buffer.head;
+    uint32_t first = head > TRACE_NUM_RECORDS ? head - TRACE_NUM_RECORDS : 0;
+
+    // Total records logged, records in the dump
+    printf("TRACE_BEGIN %u %u\n\r", head, head - first);
+    for (uint32_t i = first; i != head; i++) {
+        trace_record_t* record = &trace_buffer.records[i & (TRACE_NUM_RECORDS - 1)];
+        uint32_t nargs = record->header >> TRACE_NARGS_SHIFT;
+
+        printf("0x%08lx 0x%08lx", (unsigned long)record->header, (unsigned long)record->timestamp);
+        for (uint32_t j = 0; j < nargs && j < TRACE_MAX_ARGS; j++) {
+            printf(" 0x%08lx", (unsigned long)record->args[j]);
+        }
+        printf("\n\r");
+    }
+    printf("TRACE_END\n\r");
+}
@@ -0,0 +1,186 @@
+// Description:
+//  This file implements the AXI System Cache maintenance functions.
+//  Maintenance operations are issued one line at a time, by writing the line address to the
+//  flush or clear register of the control interface. The interface is AXI-lite and processes
+//  requests in order: a final read of a control register returns only after every previous
+//  operation completed.
+//  Statistics are free-running 64-bit counters, exposed as two 32-bit registers each.
+
+#include "uninasoc.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef CACHE_CTRL_IS_ENABLED
+
+#include "io.h"
+
+// Control registers (PG118, control interface address map)
+#define SYSCACHE_CTRL_BASE      0x1C000                     // Control registers category
+#define SYSCACHE_STAT_RESET     (SYSCACHE_CTRL_BASE + 0x000) // Clear all the statistics counters
+#define SYSCACHE_STAT_ENABLE    (SYSCACHE_CTRL_BASE + 0x008) // Enable counting, read back to wait for completion
+#define SYSCACHE_FLUSH          (SYSCACHE_CTRL_BASE + 0x200) // Clean and invalidate the line of the written address
+#define SYSCACHE_CLEAR          (SYSCACHE_CTRL_BASE + 0x208) // Invalidate the line of the written address
+
+// Statistics registers of the generic port 0 (PG118, port statistics), the MBUS port
+#define SYSCACHE_STAT_PORT_BASE     0x10000
+#define SYSCACHE_STAT_WRITE_HIT     (SYSCACHE_STAT_PORT_BASE + 0x120)
+#define SYSCACHE_STAT_WRITE_MISS    (SYSCACHE_STAT_PORT_BASE + 0x140)
+#define SYSCACHE_STAT_WRITE_DIRTY   (SYSCACHE_STAT_PORT_BASE + 0x160) // Write miss with dirty victim
+#define SYSCACHE_STAT_READ_HIT      (SYSCACHE_STAT_PORT_BASE + 0x180)
+#define SYSCACHE_STAT_READ_MISS     (SYSCACHE_STAT_PORT_BASE + 0x1A0)
+#define SYSCACHE_STAT_READ_DIRTY    (SYSCACHE_STAT_PORT_BASE + 0x1C0) // Read miss with dirty victim
+
+#define SYSCACHE_LINE_MASK      ((uintptr_t)SYSCACHE_LINE_SIZE - 1)
+
+#if (SYSCACHE_LINE_SIZE & (SYSCACHE_LINE_SIZE - 1)) != 0
+#error "SYSCACHE_LINE_SIZE must be a power of two"
+#endif
+
+// Clip [*begin, *end) to the cacheable range, returns 0 if nothing is left
+static inline int syscache_clip(uintptr_t* begin, uintptr_t* end)
+{
+    if (*begin < SYSCACHE_CACHED_BASEADDR) {
+        *begin = SYSCACHE_CACHED_BASEADDR;
+    }
+    if (*end > SYSCACHE_CACHED_ENDADDR) {
+        *end = SYSCACHE_CACHED_ENDADDR;
+    }
+    return *begin < *end;
+}
+
+// Issue the operation on every line of [begin, end), both line aligned
+static inline void syscache_lines(uintptr_t reg, uintptr_t begin, uintptr_t end)
+{
+    for (uintptr_t line = begin; line < end; line += SYSCACHE_LINE_SIZE) {
+        iowrite32(SYSCACHE_BASEADDR + reg, (uint32_t)line);
+    }
+}
+
+// Wait for the completion of the issued operations
+static inline void syscache_sync()
+{
+    (void)ioread32_fenced(SYSCACHE_BASEADDR + SYSCACHE_STAT_ENABLE);
+}
+
+// Read a 64-bit counter, consistent across the carry of the low word
+static inline uint64_t syscache_read_counter(uintptr_t reg)
+{
+    uint32_t hi, lo;
+
+    do {
+        hi = ioread32(SYSCACHE_BASEADDR + reg + 4);
+        lo = ioread32(SYSCACHE_BASEADDR + reg);
+    } while (hi != ioread32(SYSCACHE_BASEADDR + reg + 4));
+
+    return ((uint64_t)hi << 32) | lo;
+}
+
+int xlnx_syscache_flush_range(uintptr_t addr, size_t size)
+{
+    uintptr_t begin = addr & ~SYSCACHE_LINE_MASK;
+    uintptr_t end = (addr + size + SYSCACHE_LINE_MASK) & ~SYSCACHE_LINE_MASK;
+
+    if (size == 0 || !syscache_clip(&begin, &end)) {
+        return UNINASOC_OK;
+    }
+
+    // Core stores must reach the cache before their lines are written back
+    io_wmb();
+    syscache_lines(SYSCACHE_FLUSH, begin, end);
+    syscache_sync();
+
+    return UNINASOC_OK;
+}
+
+int xlnx_syscache_invalidate_range(uintptr_t addr, size_t size)
+{
+    uintptr_t begin = addr & ~SYSCACHE_LINE_MASK;
+    uintptr_t end = (addr + size + SYSCACHE_LINE_MASK) & ~SYSCACHE_LINE_MASK;
+
+    if (size == 0 || !syscache_clip(&begin, &end)) {
+        return UNINASOC_OK;
+    }
+
+    // Only fully covered lines are dropped, the edges hold data outside the range
+    uintptr_t inner_begin = (addr + SYSCACHE_LINE_MASK) & ~SYSCACHE_LINE_MASK;
+    uintptr_t inner_end = (addr + size) & ~SYSCACHE_LINE_MASK;
+    if (inner_begin < begin) {
+        inner_begin = begin;
+    }
+    if (inner_end > end) {
+        inner_end = end;
+    }
+
+    io_wmb();
+    if (inner_begin >= inner_end) {
+        // No full line: a single partial line, or two partial lines
+        syscache_lines(SYSCACHE_FLUSH, begin, end);
+    } else {
+        syscache_lines(SYSCACHE_FLUSH, begin, inner_begin);
+        syscache_lines(SYSCACHE_CLEAR, inner_begin, inner_end);
+        syscache_lines(SYSCACHE_FLUSH, inner_end, end);
+    }
+    syscache_sync();
+
+    return UNINASOC_OK;
+}
+
+int xlnx_syscache_stats_reset()
+{
+    iowrite32(SYSCACHE_BASEADDR + SYSCACHE_STAT_RESET, 1);
+    iowrite32(SYSCACHE_BASEADDR + SYSCACHE_STAT_ENABLE, 1);
+    syscache_sync();
+
+    return UNINASOC_OK;
+}
+
+int xlnx_syscache_stats_read(xlnx_syscache_stats_t* stats)
+{
+    if (stats == NULL) {
+        return UNINASOC_ERROR;
+    }
+
+    uint64_t read_dirty = syscache_read_counter(SYSCACHE_STAT_READ_DIRTY);
+    uint64_t write_dirty = syscache_read_counter(SYSCACHE_STAT_WRITE_DIRTY);
+
+    // Dirty misses are misses too
+    stats->read_hits = syscache_read_counter(SYSCACHE_STAT_READ_HIT);
+    stats->read_misses = syscache_read_counter(SYSCACHE_STAT_READ_MISS) + read_dirty;
+    stats->write_hits = syscache_read_counter(SYSCACHE_STAT_WRITE_HIT);
+    stats->write_misses = syscache_read_counter(SYSCACHE_STAT_WRITE_MISS) + write_dirty;
+    stats->evictions = read_dirty + write_dirty;
+
+    return UNINASOC_OK;
+}
+
+#else
+
+// No control interface: nothing to maintain, no statistics
+
+int xlnx_syscache_flush_range(uintptr_t addr, size_t size)
+{
+    (void)addr;
+    (void)size;
+    return UNINASOC_OK;
+}
+
+int xlnx_syscache_invalidate_range(uintptr_t addr, size_t size)
+{
+    (void)addr;
+    (void)size;
+    return UNINASOC_OK;
+}
+
+int xlnx_syscache_stats_reset()
+{
+    return UNINASOC_ERROR;
+}
+
+int xlnx_syscache_stats_read(xlnx_syscache_stats_t* stats)
+{
+    (void)stats;
+    return UNINASOC_ERROR;
+}
+
+#endif
@@ -18,6 +18,12 @@
 // Registers (both TIM0 and TIM1 have same registers)
 #define TIM_CSR 0x0000 // Control and Status register
 #define TIM_TLR 0x0004 // Load register
+#define TIM_TCR 0x0008 // Counter register
+
+// Second counter of the instance, the high half in cascade mode
+#define TIM_CSR1 0x0010
+#define TIM_TLR1 0x0014
+#define TIM_TCR1 0x0018
 
 #define TIM_CSR_COUNTER_MODE (1 << 1)
 #define TIM_CSR_RELOAD_MODE (1 << 4)
@@ -25,6 +31,7 @@
 #define TIM_CSR_ENABLE_INTERRUPT (1 << 6)
 #define TIM_CSR_ENABLE (1 << 7)
 #define TIM_CSR_INTERRUPT (1 << 8)
+#define TIM_CSR_CASCADE (1 << 11)
 
 // Extend this function implementation in case you add more peripherals
 static inline int xlnx_tim_assert(xlnx_tim_t* timer)
@@ -114,4 +121,63 @@ int xlnx_tim_start(xlnx_tim_t* timer)
     return UNINASOC_OK;
 }
 
+int xlnx_tim_stop(xlnx_tim_t* timer)
+{
+    if (xlnx_tim_assert(timer) != UNINASOC_OK) {
+        return UNINASOC_ERROR;
+    }
+
+    uintptr_t tim_csr = (uintptr_t)(timer->base_addr + TIM_CSR);
+    uint32_t csr_value = ioread32(tim_csr);
+    // Do not write back a pending interrupt flag, it would clear it
+    csr_value &= ~(TIM_CSR_ENABLE | TIM_CSR_INTERRUPT);
+    iowrite32(tim_csr, csr_value);
+    return UNINASOC_OK;
+}
+
+uint32_t xlnx_tim_get_value(xlnx_tim_t* timer)
+{
+    return ioread32((uintptr_t)(timer->base_addr + TIM_TCR));
+}
+
+int xlnx_tim_configure_cascade(xlnx_tim_t* timer)
+{
+    if (xlnx_tim_assert(timer) != UNINASOC_OK) {
+        return UNINASOC_ERROR;
+    }
+
+    uintptr_t tim_csr = (uintptr_t)(timer->base_addr + TIM_CSR);
+    uintptr_t tim_csr1 = (uintptr_t)(timer->base_addr + TIM_CSR1);
+
+    // Stop both counters, then load 0 in both halves
+    iowrite32(tim_csr, 0);
+    iowrite32(tim_csr1, 0);
+    iowrite32((uintptr_t)(timer->base_addr + TIM_TLR), 0);
+    iowrite32((uintptr_t)(timer->base_addr + TIM_TLR1), 0);
+    iowrite32(tim_csr1, TIM_CSR_LOAD);
+    iowrite32(tim_csr1, 0);
+
+    // Counting up, TCSR0 controls the cascaded counter (TCSR1 is ignored)
+    iowrite32(tim_csr, TIM_CSR_CASCADE | TIM_CSR_RELOAD_MODE | TIM_CSR_LOAD);
+    return UNINASOC_OK;
+}
+
+uint64_t xlnx_tim_get_value64(xlnx_tim_t* timer)
+{
+    uintptr_t tim_tcr = (uintptr_t)(timer->base_addr + TIM_TCR);
+    uintptr_t tim_tcr1 = (uintptr_t)(timer->base_addr + TIM_TCR1);
+    uint32_t high;
+    uint32_t low;
+    uint32_t high2;
+
+    // Re-read the high half to detect a carry from the low half, no lock needed
+    do {
+        high = ioread32(tim_tcr1);
+        low = ioread32(tim_tcr);
+        high2 = ioread32(tim_tcr1);
+    } while (high != high2);
+
+    return ((uint64_t)high << 32) | low;
+}
+
 #endif
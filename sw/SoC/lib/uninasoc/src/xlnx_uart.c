@@ -0,0 +1,215 @@
+// Description:
+//  This file implements the interrupt-driven UART driver
+
+#include "uninasoc.h"
+
+#ifdef UART_IS_ENABLED
+
+#include "io.h"
+#include <stdint.h>
+#include <stddef.h>
+
+// Registers
+#define UART_RX_FIFO    0x00 // Receive data FIFO
+#define UART_TX_FIFO    0x04 // Transmit data FIFO
+#define UART_STAT       0x08 // Status register
+#define UART_CTRL       0x0C // Control register
+
+// Status bits
+#define UART_STAT_RX_VALID      (1 << 0)
+#define UART_STAT_TX_EMPTY      (1 << 2)
+#define UART_STAT_TX_FULL       (1 << 3)
+
+// Control bits
+#define UART_CTRL_RST_TX        (1 << 0)
+#define UART_CTRL_RST_RX        (1 << 1)
+#define UART_CTRL_ENABLE_INTR   (1 << 4)
+
+#define UART_TX_MASK (UART_TX_BUFFER_SIZE - 1)
+#define UART_RX_MASK (UART_RX_BUFFER_SIZE - 1)
+
+#if (UART_TX_BUFFER_SIZE & UART_TX_MASK) != 0 || (UART_RX_BUFFER_SIZE & UART_RX_MASK) != 0
+#error "UART_TX_BUFFER_SIZE and UART_RX_BUFFER_SIZE must be powers of two"
+#endif
+
+// The rings are shared with the interrupt handler
+static inline uintptr_t xlnx_uart_irq_save()
+{
+    uintptr_t mstatus = 0;
+#ifndef CORE_PICORV32
+    asm volatile("csrrc %0, mstatus, 0x8" : "=r"(mstatus));
+#endif
+    return mstatus;
+}
+
+static inline void xlnx_uart_irq_restore(uintptr_t mstatus)
+{
+#ifndef CORE_PICORV32
+    if (mstatus & 0x8) {
+        asm volatile("csrs mstatus, 0x8");
+    }
+#endif
+}
+
+// Move bytes from the TX ring to the TX FIFO until either is exhausted.
+// Must be called with the interrupts disabled or from the interrupt handler
+static void xlnx_uart_fill_tx(xlnx_uart_t* uart)
+{
+    uint32_t tail = uart->tx_tail;
+
+    while (tail != uart->tx_head) {
+        if (ioread32(uart->base_addr + UART_STAT) & UART_STAT_TX_FULL) {
+            break;
+        }
+        iowrite32(uart->base_addr + UART_TX_FIFO, uart->tx_buffer[tail & UART_TX_MASK]);
+        tail++;
+        uart->tx_busy = 1;
+    }
+
+    uart->tx_tail = tail;
+}
+
+// Move bytes from the RX FIFO to the RX ring.
+// Must be called with the interrupts disabled or from the interrupt handler
+static void xlnx_uart_drain_rx(xlnx_uart_t* uart)
+{
+    while (ioread32(uart->base_addr + UART_STAT) & UART_STAT_RX_VALID) {
+        uint8_t c = (uint8_t)ioread32(uart->base_addr + UART_RX_FIFO);
+        if (uart->rx_head - uart->rx_tail == UART_RX_BUFFER_SIZE) {
+            uart->rx_dropped++;
+        } else {
+            uart->rx_buffer[uart->rx_head & UART_RX_MASK] = c;
+            uart->rx_head++;
+        }
+    }
+}
+
+int xlnx_uart_init(xlnx_uart_t* uart)
+{
+    if (uart->base_addr != UART_BASEADDR) {
+        return UNINASOC_ERROR;
+    }
+
+    uart->tx_head = 0;
+    uart->tx_tail = 0;
+    uart->tx_busy = 0;
+    uart->rx_head = 0;
+    uart->rx_tail = 0;
+    uart->rx_dropped = 0;
+
+    iowrite32(uart->base_addr + UART_CTRL, UART_CTRL_RST_TX | UART_CTRL_RST_RX | UART_CTRL_ENABLE_INTR);
+    return UNINASOC_OK;
+}
+
+size_t xlnx_uart_write(xlnx_uart_t* uart, const void* data, size_t len)
+{
+    const uint8_t* src = (const uint8_t*)data;
+    uint32_t head = uart->tx_head;
+    size_t space = UART_TX_BUFFER_SIZE - (head - uart->tx_tail);
+
+    if (len > space) {
+        len = space;
+    }
+
+    // Hot path: just a copy into the ring
+    for (size_t i = 0; i < len; i++) {
+        uart->tx_buffer[(head + i) & UART_TX_MASK] = src[i];
+    }
+    uart->tx_head = head + len;
+
+    // Idle transmitter: no TX-empty interrupt is coming, start it here
+    if (!uart->tx_busy && len > 0) {
+        uintptr_t mstatus = xlnx_uart_irq_save();
+        if (!uart->tx_busy) {
+            xlnx_uart_fill_tx(uart);
+        }
+        xlnx_uart_irq_restore(mstatus);
+    }
+
+    return len;
+}
+
+void xlnx_uart_putc(xlnx_uart_t* uart, char c)
+{
+    while (xlnx_uart_write(uart, &c, 1) == 0) {
+        xlnx_uart_poll(uart);
+    }
+}
+
+void xlnx_uart_puts(xlnx_uart_t* uart, const char* str)
+{
+    size_t len = 0;
+    while (str[len] != '\0') {
+        len++;
+    }
+
+    while (len > 0) {
+        size_t written = xlnx_uart_write(uart, str, len);
+        str += written;
+        len -= written;
+        if (len > 0) {
+            xlnx_uart_poll(uart);
+        }
+    }
+}
+
+size_t xlnx_uart_read(xlnx_uart_t* uart, void* data, size_t len)
+{
+    uint8_t* dst = (uint8_t*)data;
+    uint32_t tail = uart->rx_tail;
+    size_t available = uart->rx_head - tail;
+
+    if (len > available) {
+        len = available;
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        dst[i] = uart->rx_buffer[(tail + i) & UART_RX_MASK];
+    }
+    uart->rx_tail = tail + len;
+
+    return len;
+}
+
+int xlnx_uart_getc(xlnx_uart_t* uart)
+{
+    uint8_t c;
+    if (xlnx_uart_read(uart, &c, 1) == 0) {
+        return -1;
+    }
+    return c;
+}
+
+void xlnx_uart_flush(xlnx_uart_t* uart)
+{
+    while (uart->tx_head != uart->tx_tail) {
+        xlnx_uart_poll(uart);
+    }
+    while (!(ioread32(uart->base_addr + UART_STAT) & UART_STAT_TX_EMPTY));
+}
+
+void xlnx_uart_poll(xlnx_uart_t* uart)
+{
+    uintptr_t mstatus = xlnx_uart_irq_save();
+    xlnx_uart_drain_rx(uart);
+    xlnx_uart_fill_tx(uart);
+    if (uart->tx_head == uart->tx_tail) {
+        uart->tx_busy = 0;
+    }
+    xlnx_uart_irq_restore(mstatus);
+}
+
+__hot void xlnx_uart_irq_handler(xlnx_uart_t* uart)
+{
+    // The interrupt is raised on RX data or when the TX FIFO empties
+    xlnx_uart_drain_rx(uart);
+
+    if (uart->tx_head == uart->tx_tail) {
+        // Nothing left, the next write restarts the transmitter
+        uart->tx_busy = 0;
+    } else {
+        xlnx_uart_fill_tx(uart);
+    }
+}
+
+#endif
@@ -0,0 +1,96 @@
+#!/bin/python3
+# Description:
+#   Symbolize a PC-sampling profile dumped by prof_dump() (libuninasoc prof.h) against the
+#   application ELF and print a flat profile, sorted by number of samples.
+#   Symbols are read with nm from the RISC-V toolchain.
+# Args:
+#   1: Application ELF (e.g. sw/SoC/examples/<app>/bin/<app>.elf)
+#   2: UART log containing the PROF_BEGIN ... PROF_END block (default: stdin)
+# Env:
+#   NM: nm executable (default: riscv${XLEN}-unknown-elf-nm, XLEN defaults to 32)
+
+####################
+# Import libraries #
+####################
+# Parse args
+import sys
+import os
+# Run nm
+import subprocess
+# Address to symbol lookup
+import bisect
+
+#############
+# Functions #
+#############
+
+# Read the sorted list of (address, name) of the text symbols
+def read_symbols ( elf_file : str, nm : str ) -> list:
+	output = subprocess.run([nm, "-n", "--defined-only", elf_file], capture_output=True, text=True, check=True).stdout
+	symbols = []
+	for line in output.splitlines():
+		fields = line.split()
+		# <address> <type> <name>
+		if len(fields) != 3 or fields[1] not in "tTwW":
+			continue
+		symbols.append((int(fields[0], 16), fields[2]))
+	return symbols
+
+# Parse the last PROF_BEGIN ... PROF_END block
+def read_profile ( lines : list ) -> tuple:
+	header = None
+	buckets = []
+	in_block = False
+	for line in lines:
+		fields = line.strip().split()
+		if len(fields) == 0:
+			continue
+		if fields[0] == "PROF_BEGIN":
+			# text_start shift samples dropped
+			header = [int(field, 0) for field in fields[1:5]]
+			buckets = []
+			in_block = True
+		elif fields[0] == "PROF_END":
+			in_block = False
+		elif in_block and len(fields) == 2:
+			buckets.append((int(fields[0], 0), int(fields[1], 0)))
+	return header, buckets
+
+##########
+# Script #
+##########
+
+if len(sys.argv) < 2:
+	print("Usage: " + os.path.basename(sys.argv[0]) + " <elf> [uart_log]", file=sys.stderr)
+	sys.exit(1)
+
+elf_file = sys.argv[1]
+nm = os.environ.get("NM", "riscv" + os.environ.get("XLEN", "32") + "-unknown-elf-nm")
+
+if len(sys.argv) >= 3:
+	with open(sys.argv[2], errors="replace") as log_file:
+		lines = log_file.readlines()
+else:
+	lines = sys.stdin.readlines()
+
+header, buckets = read_profile(lines)
+if header is None:
+	print("[PROF] No PROF_BEGIN block found", file=sys.stderr)
+	sys.exit(1)
+
+text_start, shift, samples, dropped = header
+symbols = read_symbols(elf_file, nm)
+addresses = [address for address, _ in symbols]
+
+# Attribute each bucket to the function containing its first byte
+profile = {}
+for address, count in buckets:
+	index = bisect.bisect_right(addresses, address) - 1
+	name = symbols[index][1] if index >= 0 else "<unknown>"
+	profile[name] = profile.get(name, 0) + count
+
+total = sum(profile.values())
+print(f"Flat profile: {total} samples in .text, {dropped} outside, {1 << shift} bytes per bucket")
+print(f"{'%':>7}  {'samples':>8}  function")
+for name, count in sorted(profile.items(), key=lambda item: item[1], reverse=True):
+	print(f"{100.0 * count / total:7.2f}  {count:8d}  {name}")
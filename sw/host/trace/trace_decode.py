@@ -0,0 +1,163 @@
+#!/bin/python3
+# Description:
+#   Decode the deferred binary log of libuninasoc (trace.h) against the application ELF.
+#   Format strings are read from the non-loaded .trace_fmt ELF section (objcopy from the
+#   RISC-V toolchain), the format ID of each record being the string offset in that section.
+# Args:
+#   1: Application ELF (e.g. sw/SoC/examples/<app>/bin/<app>.elf)
+#   2: UART log containing the TRACE_BEGIN ... TRACE_END block (default: stdin),
+#      or raw readback of the trace_buffer symbol with --raw <file>
+# Env:
+#   OBJCOPY: objcopy executable (default: riscv${XLEN}-unknown-elf-objcopy, XLEN defaults to 32)
+
+####################
+# Import libraries #
+####################
+# Parse args
+import sys
+import os
+# Run objcopy
+import subprocess
+import tempfile
+# Parse raw readback
+import struct
+# Parse format strings
+import re
+
+##############
+# Parameters #
+##############
+
+TRACE_MAGIC = 0x54524330
+TRACE_MAX_ARGS = 6
+TRACE_ID_MASK = 0x00ffffff
+TRACE_NARGS_SHIFT = 24
+# magic, num_records, head, reserved
+TRACE_HEADER_FORMAT = "<4I"
+# header, timestamp, args
+TRACE_RECORD_FORMAT = "<" + str(2 + TRACE_MAX_ARGS) + "I"
+
+# printf conversions, e.g. %08lx
+CONVERSION_RE = re.compile(r"%([-+ #0]*)(\d*)(?:\.(\d+))?(?:hh|h|ll|l|z|j|t)?([diouxXcps%])")
+
+#############
+# Functions #
+#############
+
+# Read the .trace_fmt section content
+def read_formats ( elf_file : str, objcopy : str ) -> bytes:
+	with tempfile.TemporaryDirectory() as tmp_dir:
+		section_file = os.path.join(tmp_dir, "trace_fmt.bin")
+		subprocess.run([objcopy, "--dump-section", ".trace_fmt=" + section_file, elf_file], capture_output=True, check=True)
+		with open(section_file, "rb") as f:
+			return f.read()
+
+# Get the NUL-terminated string at the given offset
+def get_format ( formats : bytes, format_id : int ) -> str:
+	if format_id >= len(formats):
+		return None
+	end = formats.find(b"\0", format_id)
+	if end < 0:
+		end = len(formats)
+	return formats[format_id:end].decode(errors="replace")
+
+# Render a C format string with 32-bit raw arguments
+def render ( fmt : str, args : list ) -> str:
+	args = list(args)
+	def convert ( match : re.Match ) -> str:
+		flags, width, precision, conversion = match.groups()
+		if conversion == "%":
+			return "%"
+		value = args.pop(0) if args else 0
+		if conversion in "di":
+			# Two's complement
+			if value & 0x80000000:
+				value -= 1 << 32
+		elif conversion == "s":
+			# Only the pointer is stored
+			conversion = "x"
+			flags = "#"
+		elif conversion == "p":
+			conversion = "x"
+			flags = "#"
+		elif conversion == "c":
+			value = chr(value & 0xff)
+		spec = "%" + flags + width + ("." + precision if precision else "") + conversion
+		return spec % value
+	return CONVERSION_RE.sub(convert, fmt)
+
+# Parse the last TRACE_BEGIN ... TRACE_END block into (header, timestamp, args) records
+def read_log ( lines : list ) -> list:
+	records = None
+	in_block = False
+	for line in lines:
+		fields = line.strip().split()
+		if len(fields) == 0:
+			continue
+		if fields[0] == "TRACE_BEGIN":
+			records = []
+			in_block = True
+		elif fields[0] == "TRACE_END":
+			in_block = False
+		elif in_block and len(fields) >= 2:
+			try:
+				words = [int(field, 0) for field in fields]
+			except ValueError:
+				continue
+			records.append((words[0], words[1], words[2:]))
+	return records
+
+# Parse a raw readback of trace_buffer, oldest record first
+def read_raw ( raw_file : str ) -> list:
+	with open(raw_file, "rb") as f:
+		data = f.read()
+	magic, num_records, head, _ = struct.unpack_from(TRACE_HEADER_FORMAT, data, 0)
+	if magic != TRACE_MAGIC:
+		print("[TRACE] Bad magic 0x%08x, is trace_init() called?" % magic, file=sys.stderr)
+		sys.exit(1)
+	records = []
+	first = head - num_records if head > num_records else 0
+	for i in range(first, head):
+		offset = struct.calcsize(TRACE_HEADER_FORMAT) + (i % num_records) * struct.calcsize(TRACE_RECORD_FORMAT)
+		words = struct.unpack_from(TRACE_RECORD_FORMAT, data, offset)
+		nargs = min(words[0] >> TRACE_NARGS_SHIFT, TRACE_MAX_ARGS)
+		records.append((words[0], words[1], list(words[2:2 + nargs])))
+	return records
+
+##########
+# Script #
+##########
+
+if len(sys.argv) < 2:
+	print("Usage: " + os.path.basename(sys.argv[0]) + " <elf> [uart_log | --raw <trace_buffer.bin>]", file=sys.stderr)
+	sys.exit(1)
+
+elf_file = sys.argv[1]
+objcopy = os.environ.get("OBJCOPY", "riscv" + os.environ.get("XLEN", "32") + "-unknown-elf-objcopy")
+
+if len(sys.argv) >= 4 and sys.argv[2] == "--raw":
+	records = read_raw(sys.argv[3])
+else:
+	if len(sys.argv) >= 3:
+		with open(sys.argv[2], errors="replace") as log_file:
+			lines = log_file.readlines()
+	else:
+		lines = sys.stdin.readlines()
+	records = read_log(lines)
+	if records is None:
+		print("[TRACE] No TRACE_BEGIN block found", file=sys.stderr)
+		sys.exit(1)
+
+formats = read_formats(elf_file, objcopy)
+
+# <timestamp> (+<delta>) <message>, timestamps in core cycles (mcycle, 32-bit wrap)
+previous = None
+for header, timestamp, args in records:
+	fmt = get_format(formats, header & TRACE_ID_MASK)
+	delta = 0 if previous is None else (timestamp - previous) & 0xffffffff
+	previous = timestamp
+	if fmt is None:
+		message = "<unknown format 0x%06x> " % (header & TRACE_ID_MASK) + " ".join("0x%08x" % arg for arg in args)
+	else:
+		message = render(fmt, args).rstrip("\r\n")
+	print("%10u (+%8u) %s" % (timestamp, delta, message))